@@ -6,9 +6,13 @@
 #define MASTER_SERVER_MONET_HPP
 
 #include "monet/address/master_id.hpp"
+#include "monet/address/merge_engine.hpp"
+#include "monet/address/output_stage.hpp"
 #include "monet/address/universe.hpp"
+#include "monet/address/universe_table.hpp"
 #include "monet/channel/attribute/attribute.hpp"
 #include "monet/channel/attribute/attribute_controller.hpp"
+#include "monet/channel/attribute/attribute_store.hpp"
 #include "monet/channel/attribute/boolean.hpp"
 #include "monet/channel/attribute/intensity.hpp"
 #include "monet/channel/attribute/rgb_color.hpp"
@@ -16,16 +20,33 @@
 #include "monet/channel/attribute_definition.hpp"
 #include "monet/channel/channel.hpp"
 #include "monet/channel/configuration.hpp"
+#include "monet/interface/live_feed.hpp"
 #include "monet/interface/web_panel.hpp"
+#include "monet/sink/artnet.hpp"
+#include "monet/sink/process_host.hpp"
+#include "monet/sink/recorder.hpp"
 #include "monet/sink/sacn.hpp"
+#include "monet/sink/shared_memory.hpp"
 #include "monet/sink/sink.hpp"
+#include "monet/source/replay.hpp"
+#include "monet/source/sacn.hpp"
 #include "monet/storage/adapters/json_adapter.hpp"
 #include "monet/storage/adapters/sqlite_adapter.hpp"
 #include "monet/storage/document.hpp"
 #include "monet/storage/adapter.hpp"
 #include "monet/console_controller.hpp"
+#include "monet/cue_stack.hpp"
 #include "monet/definitions.hpp"
+#include "monet/effect_engine.hpp"
+#include "monet/fade_engine.hpp"
+#include "monet/frame_exchange.hpp"
+#include "monet/frame_scheduler.hpp"
+#include "monet/recording.hpp"
 #include "monet/server.hpp"
+#include "monet/shared_universes.hpp"
+#include "monet/show_file.hpp"
+#include "monet/sink_output.hpp"
 #include "monet/utility.hpp"
+#include "monet/worker_pool.hpp"
 
 #endif //MASTER_SERVER_MONET_HPP
@@ -27,7 +27,7 @@ namespace monet::address {
 
         // Adjust for one-based indexing, divide by channel count per universe,
         // floor (automatic with integer division), and increase by one for one-base indexing.
-        auto const universe = (std::max(a_master_address - 1, 0ull) / dmx_data_channel_count);
+        auto const universe = (std::max<size_t>(a_master_address - 1, 0) / dmx_data_channel_count);
 
         // Determine remainder.
         auto const address = a_master_address - universe * dmx_data_channel_count;
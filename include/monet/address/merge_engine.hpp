@@ -0,0 +1,330 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_MERGE_ENGINE_HPP
+#define MASTER_SERVER_MERGE_ENGINE_HPP
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "universe.hpp"
+
+namespace monet::address {
+
+    /**
+     * @brief How the sources of one priority are combined on an address.
+     */
+    enum class merge_mode : uint8_t {
+        /// Highest takes precedence: the highest value of any source wins.
+        htp,
+        /// Latest takes precedence: the value written most recently by any source wins.
+        ltp
+    };
+
+    class merge_engine;
+
+    /**
+     * @brief A writer owning its own copy of the addresses it controls, merged into the output by a merge_engine.
+     *
+     * A source only affects the addresses it has written. Releasing an address hands it back to the sources below.
+     *
+     * @note Thread-safe. Sources can be written from any thread, such as a network receiver or the web panel.
+     */
+    class merge_source {
+        friend class merge_engine;
+
+        /// The addresses of one universe controlled by the source.
+        struct layer {
+            /// Value of each address.
+            std::array<uint8_t, dmx_data_channel_count> values{};
+            /// 0xFF for each address controlled by the source, 0 otherwise.
+            std::array<uint8_t, dmx_data_channel_count> mask{};
+            /// When each address was last written, for LTP.
+            std::array<uint32_t, dmx_data_channel_count> stamps{};
+            /// One past the highest address ever written, as a universe address count.
+            size_t address_count = 0;
+            /// Priority of the universe, overriding the priority of the source.
+            std::optional<uint8_t> priority;
+        };
+
+        merge_engine& m_engine;
+        std::string m_name;
+        std::atomic<uint8_t> m_priority;
+        /// Guards the layers against the render thread merging them.
+        mutable std::mutex m_mutex;
+        std::unordered_map<size_t, std::unique_ptr<layer>> m_layers;
+
+        /// Get the layer of a universe, creating it if it does not exist. Must be called with the mutex held.
+        layer& fetch_layer(size_t a_universe);
+
+    public:
+        merge_source(merge_engine& a_engine, std::string a_name, uint8_t const a_priority) :
+            m_engine(a_engine),
+            m_name(std::move(a_name)),
+            m_priority(a_priority),
+            m_mutex(),
+            m_layers()
+        {}
+
+        merge_source(merge_source const&) = delete;
+        merge_source(merge_source&&)      = delete;
+
+        merge_source& operator = (merge_source const&) = delete;
+        merge_source& operator = (merge_source&&)      = delete;
+
+        [[nodiscard]]
+        std::string const& name() const noexcept {
+            return m_name;
+        }
+
+        /**
+         * @brief Get the priority of the source.
+         *
+         * @return The priority. Addresses controlled by a source of higher priority ignore every source below it.
+         */
+        [[nodiscard]]
+        uint8_t priority() const noexcept {
+            return m_priority.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Set the priority of the source.
+         *
+         * @param a_priority The new priority.
+         */
+        void set_priority(uint8_t a_priority);
+
+        /**
+         * @brief Get the priority of the source on a universe.
+         *
+         * @param a_universe The number of the universe.
+         *
+         * @return The priority set for the universe, or the priority of the source if none was set.
+         */
+        [[nodiscard]]
+        uint8_t priority(size_t a_universe) const;
+
+        /**
+         * @brief Set the priority of the source on a single universe, such as a protocol with a priority per universe.
+         *
+         * @param a_universe The number of the universe.
+         * @param a_priority The new priority. Kept until the universe is released.
+         */
+        void set_priority(size_t a_universe, uint8_t a_priority);
+
+        /**
+         * @brief Set the value of an address and take control of it.
+         *
+         * @param a_universe The number of the universe.
+         * @param a_address  The address, from 1 to 512.
+         * @param a_value    The new value.
+         */
+        void set_address(size_t a_universe, size_t a_address, uint8_t a_value);
+
+        /**
+         * @brief Set the values of a range of addresses and take control of them.
+         *
+         * @param a_universe The number of the universe.
+         * @param a_address  The first address, from 1 to 512.
+         * @param a_values   The new values. Values beyond address 512 are ignored.
+         */
+        void set_addresses(size_t a_universe, size_t a_address, std::span<uint8_t const> a_values);
+
+        /**
+         * @brief Hand a range of addresses back to the sources below.
+         *
+         * @param a_universe The number of the universe.
+         * @param a_address  The first address, from 1 to 512.
+         * @param a_count    The amount of addresses.
+         */
+        void release(size_t a_universe, size_t a_address, size_t a_count);
+
+        /**
+         * @brief Hand every address of a universe back to the sources below.
+         *
+         * @param a_universe The number of the universe.
+         */
+        void release(size_t a_universe);
+
+        /**
+         * @brief Hand every address back to the sources below.
+         */
+        void release_all();
+
+        /**
+         * @brief Get the value the source holds for an address.
+         *
+         * @param a_universe The number of the universe.
+         * @param a_address  The address, from 1 to 512.
+         *
+         * @return The value or an empty optional if the source does not control the address.
+         */
+        [[nodiscard]]
+        std::optional<uint8_t> address(size_t a_universe, size_t a_address) const;
+    };
+
+    /**
+     * @brief Combines the rendered universes with any number of prioritized sources into the universes output.
+     *
+     * The rendered universe table acts as one more source, controlling every address at the render priority, so
+     * channels, fades, effects, and cues keep rendering as before while overrides and external input are merged on
+     * top. For each address, the highest priority with any source controlling it wins; the sources of that priority
+     * are combined by the merge mode of the address.
+     *
+     * Merging works on whole 512 address buffers with branch-free loops (a masked byte max for HTP, selects for LTP)
+     * the compiler turns into SIMD instructions. A universe is only re-merged when one of its sources was written or
+     * its rendered universe changed, and universes no source has ever written are passed through untouched.
+     *
+     * @note Merging, modes, and creating or destroying sources belong to the render thread. Sources themselves can be
+     *       written from any thread.
+     */
+    class merge_engine {
+        friend class merge_source;
+
+        /// The merged output of one universe.
+        struct merge_state {
+            universe output;
+            /// Generation of the rendered universe last merged.
+            uint64_t rendered_generation = static_cast<uint64_t>(-1);
+            /// 0xFF for each address merged LTP, 0 for HTP.
+            std::array<uint8_t, dmx_data_channel_count> ltp_mask{};
+            /// When each rendered address last changed, for LTP.
+            std::array<uint32_t, dmx_data_channel_count> render_stamps{};
+            /// Whether any address is merged LTP.
+            bool has_ltp = false;
+        };
+
+        std::vector<std::unique_ptr<merge_source>> m_sources;
+        /// Set for each universe number when a source writes to it, cleared when it is merged.
+        std::unique_ptr<std::atomic<bool>[]> m_pending;
+        /// Index + 1 into m_states for each universe number or 0 if the universe has never been merged.
+        std::vector<uint16_t> m_state_indices;
+        std::vector<std::unique_ptr<merge_state>> m_states;
+        std::atomic<uint8_t> m_render_priority;
+        /// Source of LTP time stamps.
+        std::atomic<uint32_t> m_stamp;
+        /// A source with a layer in the universe being merged, at its priority on that universe.
+        struct ordered_source {
+            merge_source* source;
+            uint8_t priority;
+        };
+
+        /// Sources sorted by descending priority while merging. Kept between merges to reuse its allocation.
+        std::vector<ordered_source> m_order;
+
+        /// Flag a universe to be re-merged.
+        void mark_pending(size_t const a_universe) noexcept {
+            if (a_universe >= min_universe_number && a_universe <= max_universe_number) {
+                m_pending[a_universe].store(true, std::memory_order_release);
+            }
+        }
+
+        /// Get the next LTP time stamp.
+        uint32_t next_stamp() noexcept {
+            return m_stamp.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+
+        /// Get the merge state of a universe, creating it if it does not exist.
+        merge_state& fetch_state(size_t a_universe);
+
+    public:
+        merge_engine() :
+            m_sources(),
+            m_pending(std::make_unique<std::atomic<bool>[]>(max_universe_number + 1)),
+            m_state_indices(max_universe_number + 1, 0),
+            m_states(),
+            m_render_priority(default_merge_priority),
+            m_stamp(0),
+            m_order()
+        {}
+
+        merge_engine(merge_engine const&) = delete;
+        merge_engine(merge_engine&&)      = delete;
+
+        merge_engine& operator = (merge_engine const&) = delete;
+        merge_engine& operator = (merge_engine&&)      = delete;
+
+        /**
+         * @brief Create a source.
+         *
+         * @param a_name     The name of the source.
+         * @param a_priority The priority of the source.
+         *
+         * @return The source, valid until it is destroyed.
+         */
+        merge_source& create_source(std::string a_name, uint8_t a_priority = default_merge_priority);
+
+        /**
+         * @brief Destroy a source, handing every address it controls back to the sources below.
+         *
+         * @param a_source The source.
+         */
+        void destroy_source(merge_source const& a_source);
+
+        [[nodiscard]]
+        std::span<std::unique_ptr<merge_source> const> sources() const noexcept {
+            return m_sources;
+        }
+
+        /**
+         * @brief Get the priority the rendered universes are merged at.
+         *
+         * @return The render priority.
+         */
+        [[nodiscard]]
+        uint8_t render_priority() const noexcept {
+            return m_render_priority.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Set the priority the rendered universes are merged at.
+         *
+         * @param a_priority The new render priority.
+         */
+        void set_render_priority(uint8_t a_priority) noexcept;
+
+        /**
+         * @brief Set how the sources are combined on a range of addresses.
+         *
+         * @param a_universe The number of the universe.
+         * @param a_address  The first address, from 1 to 512.
+         * @param a_count    The amount of addresses.
+         * @param a_mode     The merge mode. Addresses are merged HTP by default.
+         */
+        void set_mode(size_t a_universe, size_t a_address, size_t a_count, merge_mode a_mode);
+
+        /**
+         * @brief Get how the sources are combined on an address.
+         *
+         * @param a_universe The number of the universe.
+         * @param a_address  The address, from 1 to 512.
+         *
+         * @return The merge mode.
+         */
+        [[nodiscard]]
+        merge_mode mode(size_t a_universe, size_t a_address) const noexcept;
+
+        /**
+         * @brief Merge a universe, if needed.
+         *
+         * @param a_universe The number of the universe.
+         * @param a_rendered The rendered universe, merged at the render priority.
+         *
+         * @return The merged universe or nullptr if nothing has ever been merged into the universe, in which case the
+         *         rendered universe is the output. The merged universe is only modified when the merge result changes.
+         */
+        [[nodiscard]]
+        universe const* merge(size_t a_universe, universe const& a_rendered);
+    };
+
+}
+
+#endif //MASTER_SERVER_MERGE_ENGINE_HPP
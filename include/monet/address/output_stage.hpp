@@ -0,0 +1,196 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_OUTPUT_STAGE_HPP
+#define MASTER_SERVER_OUTPUT_STAGE_HPP
+
+#include <array>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "../channel/attribute_definition.hpp"
+#include "universe.hpp"
+
+namespace monet::address {
+
+    /**
+     * @brief The response curve of a dimmer.
+     */
+    enum class dimmer_curve : uint8_t {
+        linear,
+        /// Slow at the bottom, for a more even perceived fade.
+        square,
+        /// Fast at the bottom.
+        inverse_square,
+        /// Slow at both ends (smoothstep).
+        s_curve
+    };
+
+    /**
+     * @brief How the value of an address is transformed on its way out.
+     *
+     * Applied in order: curve, gamma, limits, grand master, inversion.
+     */
+    struct output_transform {
+        dimmer_curve curve = dimmer_curve::linear;
+        float gamma = 1.0f;
+        /// Whether the value is scaled by the grand master.
+        bool mastered = false;
+        /// Lowest value output.
+        uint8_t min = 0;
+        /// Highest value output.
+        uint8_t max = 255;
+        /// Whether 0 is output as 255 and the other way around.
+        bool invert = false;
+
+        bool operator == (output_transform const&) const noexcept = default;
+
+        /**
+         * @brief Check if the transform leaves every value unchanged, regardless of the grand master.
+         *
+         * @return True for the identity transform.
+         */
+        [[nodiscard]]
+        bool identity() const noexcept {
+            return *this == output_transform();
+        }
+
+        /**
+         * @brief Read a transform from the properties of an attribute definition.
+         *
+         * @param a_definition The attribute definition. Recognized properties are "curve" (linear, square,
+         *                     inverse_square, s), "gamma", "master" (true/false), "min" and "max" (0-255), and
+         *                     "invert" (true/false). Unrecognized or malformed values are ignored.
+         * @param a_mastered   Whether the address is scaled by the grand master unless the "master" property says
+         *                     otherwise.
+         *
+         * @return The transform.
+         */
+        [[nodiscard]]
+        static output_transform from_properties(channel::attribute_definition const& a_definition, bool a_mastered = false) noexcept;
+    };
+
+    /**
+     * @brief Transforms the universes on their way to the sinks with per address lookup tables.
+     *
+     * Every distinct transform is precomputed, together with the grand master, into a 256 entry table, so each
+     * transformed address costs one table lookup per frame no matter how many steps its transform has. Each universe
+     * keeps a bit mask of the addresses whose table is not the identity; the pass walks the set bits only, so
+     * untransformed addresses, and whole 64 address blocks of them, cost nothing.
+     *
+     * @note Not thread-safe. Owned by the render thread.
+     */
+    class output_stage {
+        /// The transformed output of one universe.
+        struct state {
+            universe output;
+            /// The universe last transformed and its generation.
+            universe const* source = nullptr;
+            uint64_t source_generation = 0;
+            /// The stage revision last transformed with.
+            uint64_t revision = static_cast<uint64_t>(-1);
+            /// Index into m_transforms for each address.
+            std::array<uint16_t, dmx_data_channel_count> transforms{};
+            /// Set bit for each address with a table that is not the identity.
+            std::array<uint64_t, dmx_data_channel_count / 64> mask{};
+        };
+
+        /// Every distinct transform in use. The first is the identity.
+        std::vector<output_transform> m_transforms;
+        /// A 256 entry table for each transform, composed with the grand master.
+        std::vector<uint8_t> m_tables;
+        /// Whether the table of each transform is the identity at the current grand master.
+        std::vector<bool> m_identity_tables;
+        /// Index + 1 into m_states for each universe number or 0 if the universe has never been transformed.
+        std::vector<uint16_t> m_state_indices;
+        std::vector<std::unique_ptr<state>> m_states;
+        uint8_t m_grand_master;
+        /// Incremented whenever the transforms or tables change.
+        uint64_t m_revision;
+
+        /// Recompute every table from its transform and the grand master.
+        void build_tables();
+
+    public:
+        output_stage() :
+            m_transforms{ output_transform() },
+            m_tables(),
+            m_identity_tables(),
+            m_state_indices(max_universe_number + 1, 0),
+            m_states(),
+            m_grand_master(255),
+            m_revision(0)
+        {
+            build_tables();
+        }
+
+        output_stage(output_stage const&) = delete;
+        output_stage(output_stage&&)      = delete;
+
+        output_stage& operator = (output_stage const&) = delete;
+        output_stage& operator = (output_stage&&)      = delete;
+
+        /**
+         * @brief Compute the lookup table of a transform.
+         *
+         * @param a_transform    The transform.
+         * @param a_grand_master The grand master level, applied if the transform is mastered.
+         * @param a_table        The table to fill, indexed by input value.
+         */
+        static void build_table(output_transform const& a_transform, uint8_t a_grand_master, std::span<uint8_t, 256> a_table) noexcept;
+
+        /**
+         * @brief Set the transform of an address.
+         *
+         * @param a_universe  The number of the universe.
+         * @param a_address   The address, from 1 to 512.
+         * @param a_transform The transform.
+         */
+        void set_transform(size_t a_universe, size_t a_address, output_transform const& a_transform);
+
+        /**
+         * @brief Get the transform of an address.
+         *
+         * @param a_universe The number of the universe.
+         * @param a_address  The address, from 1 to 512.
+         *
+         * @return The transform, the identity if none was set.
+         */
+        [[nodiscard]]
+        output_transform const& transform(size_t a_universe, size_t a_address) const noexcept;
+
+        /**
+         * @brief Reset every address to the identity transform.
+         */
+        void clear() noexcept;
+
+        [[nodiscard]]
+        uint8_t grand_master() const noexcept {
+            return m_grand_master;
+        }
+
+        /**
+         * @brief Set the grand master.
+         *
+         * @param a_level The level every mastered address is scaled by, 255 for full.
+         */
+        void set_grand_master(uint8_t a_level);
+
+        /**
+         * @brief Transform a universe, if needed.
+         *
+         * @param a_universe The number of the universe.
+         * @param a_source   The universe to transform.
+         *
+         * @return The transformed universe or nullptr if no address of the universe has ever had a transform, in which
+         *         case the source is the output. The transformed universe is only modified when the result changes.
+         */
+        [[nodiscard]]
+        universe const* apply(size_t a_universe, universe const& a_source);
+    };
+
+}
+
+#endif //MASTER_SERVER_OUTPUT_STAGE_HPP
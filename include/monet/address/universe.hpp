@@ -5,10 +5,12 @@
 #ifndef MASTER_SERVER_UNIVERSE_HPP
 #define MASTER_SERVER_UNIVERSE_HPP
 
-#include <vector>
+#include <array>
 #include <cstdint>
 #include <span>
 #include <cstring>
+#include <utility>
+#include <algorithm>
 
 #include "../definitions.hpp"
 
@@ -17,21 +19,29 @@ namespace monet::address {
     /**
      * @brief Stores data for one universe.
      *
-     * A storage object for a universe (1 byte start code + 512 byte data).
+     * A storage object for a universe (1 byte start code + 512 byte data). The data is stored inline and aligned to a
+     * cache line so universes can be packed into contiguous slots.
      */
-    class universe {
+    class alignas(cache_line_size) universe {
         /// Internal storage buffer for universe data.
-        std::vector<std::uint8_t> m_data;
+        std::array<std::uint8_t, universe_buffer_size> m_data;
         /// Amount of addresses in use.
         size_t m_address_count;
+        /// Incremented on every modification.
+        uint64_t m_generation;
+        /// The lowest address modified since the dirty range was last cleared.
+        uint16_t m_dirty_first;
+        /// One past the highest address modified since the dirty range was last cleared.
+        uint16_t m_dirty_last;
 
     public:
         universe() :
             m_data(),
-            m_address_count(0)
-        {
-            m_data.resize(universe_buffer_size, 0);
-        }
+            m_address_count(0),
+            m_generation(0),
+            m_dirty_first(0),
+            m_dirty_last(0)
+        {}
 
         /// Retrieve the internal buffer of the universe data (1 byte start code + 512 byte data).
         [[nodiscard]]
@@ -39,7 +49,11 @@ namespace monet::address {
             return m_data.data();
         }
 
-        /// Retrieve the internal buffer of the universe data (1 byte start code + 512 byte data).
+        /**
+         * @brief Retrieve the internal buffer of the universe data (1 byte start code + 512 byte data).
+         *
+         * @note Writes through this buffer are not tracked. Call mark_dirty() for the addresses written.
+         */
         [[nodiscard]]
         uint8_t* buffer() noexcept {
             return m_data.data();
@@ -57,9 +71,13 @@ namespace monet::address {
          */
         void set_address(size_t const a_index, uint8_t const a_value) noexcept {
             if (a_index < universe_buffer_size) [[likely]] {
-                m_data[a_index] = a_value;
                 // Set address count to include current address if not already.
                 m_address_count = std::max(m_address_count, a_index + 1);
+
+                if (m_data[a_index] != a_value) {
+                    m_data[a_index] = a_value;
+                    mark_dirty(a_index, a_index + 1);
+                }
             }
         }
 
@@ -76,7 +94,33 @@ namespace monet::address {
                 std::memcpy(m_data.data() + a_index, a_values.data(), a_values.size());
                 // Set address count to include current addresses if not already.
                 m_address_count = std::max(m_address_count, a_index + a_values.size());
+                mark_dirty(a_index, a_index + a_values.size());
+            }
+        }
+
+        /**
+         * @brief Get a writable range of addresses.
+         *
+         * @param a_index The starting address of the range.
+         * @param a_count The amount of addresses in the range.
+         *
+         * @return A span over the addresses, truncated to the end of the universe.
+         *
+         * Get a range of the internal buffer to write address values into directly, avoiding an intermediate buffer.
+         * The addresses in the range are counted as in use and marked dirty.
+         */
+        [[nodiscard]]
+        std::span<uint8_t> address_range(size_t const a_index, size_t const a_count) noexcept {
+            if (a_index >= universe_buffer_size) [[unlikely]] {
+                return {};
             }
+
+            auto const count = std::min(a_count, universe_buffer_size - a_index);
+            // Set address count to include the range if not already.
+            m_address_count = std::max(m_address_count, a_index + count);
+            mark_dirty(a_index, a_index + count);
+
+            return { m_data.data() + a_index, count };
         }
 
         /**
@@ -111,6 +155,71 @@ namespace monet::address {
          void set_address_count(size_t a_address_count) noexcept {
              m_address_count = a_address_count;
          }
+
+         /**
+          * @brief Get the generation of the universe.
+          *
+          * @return A counter incremented on every modification of the universe data.
+          *
+          * Consumers can store the generation they last processed to tell whether the universe has changed since,
+          * independent of other consumers.
+          */
+         [[nodiscard]]
+         uint64_t generation() const noexcept {
+             return m_generation;
+         }
+
+         /**
+          * @brief Check if any address has been modified since the dirty range was last cleared.
+          *
+          * @return True if the dirty range is not empty.
+          */
+         [[nodiscard]]
+         bool dirty() const noexcept {
+             return m_dirty_first < m_dirty_last;
+         }
+
+         /**
+          * @brief Get the range of addresses modified since the dirty range was last cleared.
+          *
+          * @return The first address and one past the last address modified. Both are zero if nothing was modified.
+          */
+         [[nodiscard]]
+         std::pair<size_t, size_t> dirty_range() const noexcept {
+             return { m_dirty_first, m_dirty_last };
+         }
+
+         /**
+          * @brief Mark a range of addresses as modified.
+          *
+          * @param a_first The first address modified.
+          * @param a_last  One past the last address modified.
+          */
+         void mark_dirty(size_t const a_first, size_t const a_last) noexcept {
+             if (a_first >= a_last) [[unlikely]] {
+                 return;
+             }
+
+             if (dirty()) {
+                 m_dirty_first = static_cast<uint16_t>(std::min<size_t>(m_dirty_first, a_first));
+                 m_dirty_last  = static_cast<uint16_t>(std::max<size_t>(m_dirty_last, a_last));
+             } else {
+                 m_dirty_first = static_cast<uint16_t>(a_first);
+                 m_dirty_last  = static_cast<uint16_t>(a_last);
+             }
+
+             ++m_generation;
+         }
+
+         /**
+          * @brief Clear the dirty range.
+          *
+          * @note Does not affect the generation.
+          */
+         void clear_dirty() noexcept {
+             m_dirty_first = 0;
+             m_dirty_last  = 0;
+         }
     };
 
 }
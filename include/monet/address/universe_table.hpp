@@ -0,0 +1,236 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_UNIVERSE_TABLE_HPP
+#define MASTER_SERVER_UNIVERSE_TABLE_HPP
+
+#include <array>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "universe.hpp"
+
+namespace monet::address {
+
+    /**
+     * @brief Stores all universes in fixed-size, cache-line-aligned slots, indexed directly by universe number.
+     *
+     * Universes are allocated into contiguous chunks of slots in order of creation and never move, so references to
+     * them stay valid for the lifetime of the table. A slot table covering every valid universe number maps a
+     * universe number straight to its slot, so lookups involve no hashing. Iterating walks the slots in order.
+     */
+    class universe_table {
+    public:
+        /// Amount of universe slots allocated at once.
+        constexpr static size_t chunk_size = 64;
+        /// Slot index returned for universes that have not been created.
+        constexpr static size_t npos = static_cast<size_t>(-1);
+
+    private:
+        /// A contiguous block of universe slots.
+        using chunk = std::array<universe, chunk_size>;
+
+        /// Slot storage.
+        std::vector<std::unique_ptr<chunk>> m_chunks;
+        /// Slot index + 1 for each universe number or 0 if the universe has not been created.
+        std::vector<uint16_t> m_slots;
+        /// Universe number for each slot in use.
+        std::vector<uint16_t> m_slot_universes;
+
+        template <bool v_const>
+        class basic_iterator {
+            using table_type    = std::conditional_t<v_const, universe_table const, universe_table>;
+            using universe_type = std::conditional_t<v_const, universe const, universe>;
+
+            table_type* m_table;
+            size_t m_slot;
+
+        public:
+            using value_type = std::pair<size_t, universe_type&>;
+
+            basic_iterator(table_type* const a_table, size_t const a_slot) noexcept :
+                m_table(a_table),
+                m_slot(a_slot)
+            {}
+
+            value_type operator * () const noexcept {
+                return { m_table->slot_universe(m_slot), m_table->slot(m_slot) };
+            }
+
+            basic_iterator& operator ++ () noexcept {
+                ++m_slot;
+                return *this;
+            }
+
+            bool operator == (basic_iterator const& a_other) const noexcept {
+                return m_slot == a_other.m_slot;
+            }
+        };
+
+    public:
+        using iterator       = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+
+        universe_table() :
+            m_chunks(),
+            m_slots(max_universe_number + 1, 0),
+            m_slot_universes()
+        {}
+
+        universe_table(universe_table const&) = delete;
+        universe_table(universe_table&&)      = delete;
+
+        universe_table& operator = (universe_table const&) = delete;
+        universe_table& operator = (universe_table&&)      = delete;
+
+        /**
+         * @brief Check if a universe number is within the valid range.
+         *
+         * @param a_universe The universe number to check.
+         *
+         * @return True if the universe number can be stored in the table.
+         */
+        [[nodiscard]]
+        constexpr static bool valid(size_t const a_universe) noexcept {
+            return a_universe >= min_universe_number && a_universe <= max_universe_number;
+        }
+
+        /**
+         * @brief Create a universe or retrieve it if it already exists.
+         *
+         * @param a_universe The number of the universe.
+         *
+         * @return A reference to the universe.
+         *
+         * @note Throws std::out_of_range if the universe number is not valid.
+         */
+        universe& create(size_t a_universe);
+
+        /**
+         * @brief Retrieve the universe with the specified number.
+         *
+         * @param a_universe The number of the universe.
+         *
+         * @return A pointer to the universe or nullptr if it has not been created.
+         */
+        [[nodiscard]]
+        universe* find(size_t const a_universe) noexcept {
+            if (!valid(a_universe) || m_slots[a_universe] == 0) {
+                return nullptr;
+            }
+
+            return &slot(m_slots[a_universe] - 1);
+        }
+
+        /**
+         * @brief Retrieve the universe with the specified number.
+         *
+         * @param a_universe The number of the universe.
+         *
+         * @return A pointer to the universe or nullptr if it has not been created.
+         */
+        [[nodiscard]]
+        universe const* find(size_t const a_universe) const noexcept {
+            if (!valid(a_universe) || m_slots[a_universe] == 0) {
+                return nullptr;
+            }
+
+            return &slot(m_slots[a_universe] - 1);
+        }
+
+        /**
+         * @brief Get the slot a universe is stored in.
+         *
+         * @param a_universe The number of the universe.
+         *
+         * @return The slot index or npos if the universe has not been created.
+         */
+        [[nodiscard]]
+        size_t slot_index(size_t const a_universe) const noexcept {
+            if (!valid(a_universe) || m_slots[a_universe] == 0) {
+                return npos;
+            }
+
+            return m_slots[a_universe] - 1;
+        }
+
+        /**
+         * @brief Check if a universe has been created.
+         *
+         * @param a_universe The number of the universe.
+         *
+         * @return True if the universe exists.
+         */
+        [[nodiscard]]
+        bool contains(size_t const a_universe) const noexcept {
+            return valid(a_universe) && m_slots[a_universe] != 0;
+        }
+
+        /**
+         * @brief Get the amount of universes created.
+         *
+         * @return The amount of slots in use.
+         */
+        [[nodiscard]]
+        size_t size() const noexcept {
+            return m_slot_universes.size();
+        }
+
+        /**
+         * @brief Get the universe stored in a slot.
+         *
+         * @param a_slot The slot index, less than size().
+         *
+         * @return A reference to the universe in the slot.
+         */
+        [[nodiscard]]
+        universe& slot(size_t const a_slot) noexcept {
+            return (*m_chunks[a_slot / chunk_size])[a_slot % chunk_size];
+        }
+
+        /**
+         * @brief Get the universe stored in a slot.
+         *
+         * @param a_slot The slot index, less than size().
+         *
+         * @return A reference to the universe in the slot.
+         */
+        [[nodiscard]]
+        universe const& slot(size_t const a_slot) const noexcept {
+            return (*m_chunks[a_slot / chunk_size])[a_slot % chunk_size];
+        }
+
+        /**
+         * @brief Get the number of the universe stored in a slot.
+         *
+         * @param a_slot The slot index, less than size().
+         *
+         * @return The universe number.
+         */
+        [[nodiscard]]
+        size_t slot_universe(size_t const a_slot) const noexcept {
+            return m_slot_universes[a_slot];
+        }
+
+        iterator begin() noexcept {
+            return { this, 0 };
+        }
+
+        iterator end() noexcept {
+            return { this, size() };
+        }
+
+        const_iterator begin() const noexcept {
+            return { this, 0 };
+        }
+
+        const_iterator end() const noexcept {
+            return { this, size() };
+        }
+    };
+
+}
+
+#endif //MASTER_SERVER_UNIVERSE_TABLE_HPP
@@ -5,11 +5,13 @@
 #ifndef MASTER_SERVER_ATTRIBUTE_HPP
 #define MASTER_SERVER_ATTRIBUTE_HPP
 
+#include <optional>
 #include <span>
 #include <string>
 #include <vector>
 
 #include "../../definitions.hpp"
+#include "attribute_store.hpp"
 
 namespace monet::channel::attribute {
 
@@ -19,10 +21,17 @@ namespace monet::channel::attribute {
      * Allows values of attributes to be queried through a standardized interface. Attributes open up channels through
      * which different byte values can be retrieved. Channels are referenced by unsigned integers, defined respectively
      * by the attribute subclass.
+     *
+     * Attribute objects are views: their values live in a slot of the attribute pool of their type, shared by every
+     * attribute of that type in the same attribute store.
      */
     class attribute {
         /// Attribute type name.
         std::string_view const m_name;
+        /// The pool holding the values of the attribute.
+        attribute_pool& m_pool;
+        /// The slot of the attribute in the pool and its values, which never move.
+        attribute_pool::allocation const m_slot;
 
     public:
         /// Base channel ID.
@@ -30,17 +39,70 @@ namespace monet::channel::attribute {
 
     protected:
         /**
-         * @brief Initialize the attribute superclass.
+         * @brief Initialize the attribute superclass and allocate its values.
+         *
+         * @param a_name       The type name of the attribute.
+         * @param a_store      The store to allocate the values of the attribute in.
+         * @param a_value_size The amount of bytes the attribute type stores.
+         */
+        attribute(std::string_view const a_name, attribute_store& a_store, size_t const a_value_size) :
+            m_name(a_name),
+            m_pool(a_store.pool(a_name, a_value_size)),
+            m_slot(m_pool.allocate())
+        {}
+
+        /**
+         * @brief Get the stored values of the attribute.
+         *
+         * @note Stable for the lifetime of the attribute.
+         */
+        [[nodiscard]]
+        uint8_t* values() noexcept {
+            return m_slot.values;
+        }
+
+        /**
+         * @brief Get the stored values of the attribute.
+         *
+         * @note Stable for the lifetime of the attribute.
+         */
+        [[nodiscard]]
+        uint8_t const* values() const noexcept {
+            return m_slot.values;
+        }
+
+        /**
+         * @brief Read a 16-bit value stored as a coarse byte followed by a fine byte.
+         *
+         * @param a_offset The offset of the coarse byte within the values of the attribute.
+         */
+        [[nodiscard]]
+        uint16_t load_16(size_t const a_offset) const noexcept {
+            auto const* const values = this->values();
+            return static_cast<uint16_t>((values[a_offset] << 8) | values[a_offset + 1]);
+        }
+
+        /**
+         * @brief Store a 16-bit value as a coarse byte followed by a fine byte.
+         *
+         * Storing the coarse byte first lets renderers read either byte straight out of the pool.
          *
-         * @param a_name The type name of the attribute.
+         * @param a_offset The offset of the coarse byte within the values of the attribute.
+         * @param a_value  The value to store.
          */
-        explicit attribute(std::string_view const a_name) : m_name(a_name) {}
+        void store_16(size_t const a_offset, uint16_t const a_value) noexcept {
+            auto* const values = this->values();
+            values[a_offset]     = static_cast<uint8_t>(a_value >> 8);
+            values[a_offset + 1] = static_cast<uint8_t>(a_value);
+        }
 
     public:
         attribute(attribute const&) = delete;
         attribute(attribute&&)      = delete;
 
-        virtual ~attribute() = default;
+        virtual ~attribute() {
+            m_pool.release(m_slot.slot);
+        }
 
         attribute& operator = (attribute const&) = delete;
         attribute& operator = (attribute&&)      = delete;
@@ -74,6 +136,47 @@ namespace monet::channel::attribute {
         [[nodiscard]]
         virtual uint8_t value(attribute_channel a_channel) const noexcept = 0;
 
+        /**
+         * @brief Get the pool holding the values of the attribute.
+         */
+        [[nodiscard]]
+        attribute_pool const& pool() const noexcept {
+            return m_pool;
+        }
+
+        /**
+         * @brief Get the slot of the attribute in its pool.
+         */
+        [[nodiscard]]
+        size_t slot() const noexcept {
+            return m_slot.slot;
+        }
+
+        /**
+         * @brief Get the values of the attribute in its pool, for reading channels stored verbatim.
+         *
+         * @return A pointer to the first of pool().stride() bytes, valid for the lifetime of the attribute.
+         */
+        [[nodiscard]]
+        uint8_t const* stored_values() const noexcept {
+            return m_slot.values;
+        }
+
+        /**
+         * @brief Get where the value of a channel is stored, if it is stored verbatim.
+         *
+         * @param a_channel The channel ID.
+         *
+         * @return The offset of the value within the slot of the attribute, or std::nullopt if the value of the channel
+         *         is derived and must be read through value().
+         *
+         * Lets renderers read channel values straight out of the pool instead of through a virtual call.
+         */
+        [[nodiscard]]
+        virtual std::optional<size_t> value_offset(attribute_channel a_channel) const noexcept {
+            return std::nullopt;
+        }
+
         /**
          * @brief Get the value of the default channel.
          *
@@ -96,6 +199,32 @@ namespace monet::channel::attribute {
          */
         virtual void set_value(attribute_channel a_channel, uint8_t a_value) = 0;
 
+        /**
+         * @brief Get the value of a channel at 16-bit resolution.
+         *
+         * @param a_channel The channel ID.
+         *
+         * @return The value of the channel, scaled to 0-65535.
+         *
+         * @note Defaults to scaling value(). Attributes with 16-bit internal resolution override it.
+         */
+        [[nodiscard]]
+        virtual uint16_t value_16(attribute_channel const a_channel) const noexcept {
+            return static_cast<uint16_t>(value(a_channel) * 257);
+        }
+
+        /**
+         * @brief Set the value of a channel at 16-bit resolution.
+         *
+         * @param a_channel The channel ID.
+         * @param a_value   The value to set the channel, scaled to 0-65535.
+         *
+         * @note Defaults to set_value() with the coarse byte. Attributes with 16-bit internal resolution override it.
+         */
+        virtual void set_value_16(attribute_channel const a_channel, uint16_t const a_value) {
+            set_value(a_channel, static_cast<uint8_t>(a_value >> 8));
+        }
+
         /**
          * @brief Get the channel ID of the corresponding channel name.
          *
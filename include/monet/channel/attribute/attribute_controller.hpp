@@ -29,7 +29,7 @@ namespace monet::channel::attribute {
     class registry {
     public:
         /// A callback to an ambiguous attribute constructor function that returns the attribute interface class.
-        using attribute_instantiation_callback = std::unique_ptr<attribute> (*)();
+        using attribute_instantiation_callback = std::unique_ptr<attribute> (*)(attribute_store&);
 
     private:
         /// Retrieve static callback map.
@@ -43,12 +43,16 @@ namespace monet::channel::attribute {
          * @brief Instantiates a specific attribute class and returns it as an abstracted interface object.
          *
          * @param a_attribute_name The name of the attribute of which to instantiate a class.
+         * @param a_store          The store to allocate the values of the attribute in.
          *
          * @return A pointer to the abstracted attribute interface object.
          *
          * @note If the name provided does not match any registered attribute class, a null pointer will be returned.
          */
-        static std::unique_ptr<attribute> instantiate_attribute(std::string_view const a_attribute_name) {
+        static std::unique_ptr<attribute> instantiate_attribute(
+            std::string_view const a_attribute_name,
+            attribute_store& a_store = attribute_store::default_store()
+        ) {
             auto& instantiation_callbacks = exchange_instantiation_callbacks();
 
             auto it = instantiation_callbacks.find(a_attribute_name);
@@ -57,7 +61,7 @@ namespace monet::channel::attribute {
                 return nullptr;
             }
 
-            return it->second();
+            return it->second(a_store);
         }
 
         /**
@@ -75,9 +79,9 @@ namespace monet::channel::attribute {
                 instantiation_callbacks.emplace(
                     v_attribute_name.to_string_view(),
                     // Lambda to dynamically instantiate, cast, and return the registered class as the polymorphic 'attribute'.
-                    []() -> std::unique_ptr<attribute> {
+                    [](attribute_store& a_store) -> std::unique_ptr<attribute> {
                         return std::unique_ptr<attribute>(
-                            dynamic_cast<attribute*>(new t_attribute_class)
+                            dynamic_cast<attribute*>(new t_attribute_class(a_store))
                         );
                     }
                 );
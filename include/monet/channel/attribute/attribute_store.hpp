@@ -0,0 +1,199 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_ATTRIBUTE_STORE_HPP
+#define MASTER_SERVER_ATTRIBUTE_STORE_HPP
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "../../definitions.hpp"
+
+namespace monet::channel::attribute {
+
+    /**
+     * @brief Dense storage for the values of every attribute of one type.
+     *
+     * Values are stored in fixed-size slots, e.g. one byte per intensity or three bytes per RGB color, packed into
+     * chunks of attribute_pool_chunk_slots slots, so walking the values of thousands of attributes streams through
+     * memory. Chunks are never moved or freed while the pool exists, so pointers to the values of a slot stay valid
+     * when the pool grows: render plans, fades, and effects keep reading and writing them while attributes are created.
+     *
+     * Allocating and releasing slots is thread-safe. Reading and writing values is not synchronized.
+     */
+    class attribute_pool {
+    public:
+        /// An allocated slot.
+        struct allocation {
+            /// The index of the slot.
+            size_t slot;
+            /// The values of the slot.
+            uint8_t* values;
+        };
+
+    private:
+        /// Amount of bytes in each slot.
+        size_t const m_stride;
+        /// Guards allocation.
+        std::mutex m_mutex;
+        /// Values of all slots, attribute_pool_chunk_slots slots per chunk, slot after slot.
+        std::vector<std::unique_ptr<uint8_t[]>> m_chunks;
+        /// Amount of slots allocated, including released slots.
+        std::atomic<size_t> m_size;
+        /// Released slots available for reuse.
+        std::vector<size_t> m_free_slots;
+
+    public:
+        /**
+         * @brief Create an empty attribute pool.
+         *
+         * @param a_stride The amount of bytes in each slot.
+         */
+        explicit attribute_pool(size_t const a_stride) noexcept :
+            m_stride(a_stride),
+            m_mutex(),
+            m_chunks(),
+            m_size(0),
+            m_free_slots()
+        {}
+
+        attribute_pool(attribute_pool const&) = delete;
+        attribute_pool(attribute_pool&&)      = delete;
+
+        attribute_pool& operator = (attribute_pool const&) = delete;
+        attribute_pool& operator = (attribute_pool&&)      = delete;
+
+        /**
+         * @brief Allocate a zeroed slot.
+         *
+         * @return The index of the slot and a pointer to its stride() bytes, valid for as long as the pool exists.
+         *
+         * @note May add a chunk, but never moves the values of existing slots.
+         */
+        allocation allocate();
+
+        /**
+         * @brief Release a slot for reuse.
+         *
+         * @param a_slot The index of the slot.
+         */
+        void release(size_t a_slot);
+
+        /**
+         * @brief Get the amount of bytes in each slot.
+         */
+        [[nodiscard]]
+        size_t stride() const noexcept {
+            return m_stride;
+        }
+
+        /**
+         * @brief Get the amount of slots, including released slots.
+         */
+        [[nodiscard]]
+        size_t size() const noexcept {
+            return m_size.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Get the values of a slot.
+         *
+         * @param a_slot The index of the slot.
+         *
+         * @return A pointer to the first of stride() bytes, valid for as long as the pool exists.
+         *
+         * @note Must not be called while another thread allocates a slot. Attributes keep the pointer instead.
+         */
+        [[nodiscard]]
+        uint8_t* values(size_t const a_slot) noexcept {
+            return m_chunks[a_slot / attribute_pool_chunk_slots].get() + a_slot % attribute_pool_chunk_slots * m_stride;
+        }
+
+        /**
+         * @brief Get the values of a slot.
+         *
+         * @param a_slot The index of the slot.
+         *
+         * @return A pointer to the first of stride() bytes, valid for as long as the pool exists.
+         *
+         * @note Must not be called while another thread allocates a slot. Attributes keep the pointer instead.
+         */
+        [[nodiscard]]
+        uint8_t const* values(size_t const a_slot) const noexcept {
+            return m_chunks[a_slot / attribute_pool_chunk_slots].get() + a_slot % attribute_pool_chunk_slots * m_stride;
+        }
+
+        /**
+         * @brief Get the amount of chunks.
+         */
+        [[nodiscard]]
+        size_t chunk_count() const noexcept {
+            return (size() + attribute_pool_chunk_slots - 1) / attribute_pool_chunk_slots;
+        }
+
+        /**
+         * @brief Get the values of the slots of a chunk, for bulk operations.
+         *
+         * @param a_chunk The index of the chunk.
+         *
+         * @return stride() bytes per allocated slot of the chunk, slot after slot.
+         */
+        [[nodiscard]]
+        std::span<uint8_t const> chunk(size_t a_chunk) const noexcept;
+    };
+
+    /**
+     * @brief Holds one attribute pool per attribute type.
+     */
+    class attribute_store {
+        /// Guards the pools of the store, which may be shared by threads creating attributes.
+        mutable std::mutex m_mutex;
+        /// Pools by attribute type name. Pools never move once created.
+        std::map<std::string_view, std::unique_ptr<attribute_pool>, std::less<>> m_pools;
+
+    public:
+        attribute_store() = default;
+
+        attribute_store(attribute_store const&) = delete;
+        attribute_store(attribute_store&&)      = delete;
+
+        attribute_store& operator = (attribute_store const&) = delete;
+        attribute_store& operator = (attribute_store&&)      = delete;
+
+        /**
+         * @brief Get the pool of an attribute type, creating it if it does not exist.
+         *
+         * @param a_type   The attribute type name. Must outlive the store.
+         * @param a_stride The amount of bytes each attribute of the type stores.
+         *
+         * @return The pool.
+         */
+        attribute_pool& pool(std::string_view a_type, size_t a_stride);
+
+        /**
+         * @brief Find the pool of an attribute type.
+         *
+         * @param a_type The attribute type name.
+         *
+         * @return The pool or nullptr if no attribute of the type has been created.
+         */
+        [[nodiscard]]
+        attribute_pool* find_pool(std::string_view a_type) noexcept;
+
+        /**
+         * @brief Get the store used by attributes created outside of a server.
+         *
+         * @note Shared by every thread creating such attributes; pools are created and slots allocated under a lock.
+         */
+        static attribute_store& default_store() noexcept;
+    };
+
+}
+
+#endif //MASTER_SERVER_ATTRIBUTE_STORE_HPP
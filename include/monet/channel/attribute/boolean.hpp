@@ -26,17 +26,17 @@ namespace monet::channel::attribute {
      *      <tr> <td>inverse       <td> 0x1   <td>255/0    <td>A value of 255 or 0 depending on the inverse of the state; 255 = false/off, 0 = true/on.
      */
     class boolean : public attribute {
-        bool m_state;
-
     public:
         constexpr static attribute_channel binary = 0x1;
         constexpr static attribute_channel inverse = 0x2;
 
         constexpr static size_t boolean_threshold = 127;
 
-        boolean() :
-            attribute("boolean"),
-            m_state(false)
+        /// Stored values: the state as 0 or 1.
+        constexpr static size_t value_size = 1;
+
+        explicit boolean(attribute_store& a_store = attribute_store::default_store()) :
+            attribute("boolean", a_store, value_size)
         {}
 
         boolean(boolean const&) noexcept = delete;
@@ -82,7 +82,7 @@ namespace monet::channel::attribute {
          */
         [[nodiscard]]
         bool state_value() const noexcept {
-            return m_state;
+            return values()[0];
         }
 
         /**
@@ -91,7 +91,7 @@ namespace monet::channel::attribute {
          * @param a_value The value to set the internal state value.
          */
         void set_intensity_value(bool const a_value) noexcept {
-            m_state = a_value;
+            values()[0] = a_value;
         }
     };
 
@@ -23,17 +23,20 @@ namespace monet::channel::attribute {
      *
      *      <tr> <td>default       <td> 0x0   <td>0-255    <td>A value of 0-255 based on intensity; 0 = out (0%), 127 = half (50%), 255 = full (100%).
      *      <tr> <td>exact         <td> 0x1   <td>0-100    <td>A more human-readable value of 0-100 based on percentage of intensity; 0 = out (0%), 50 = half (50%), 100 = full (100%).
+     *      <tr> <td>base_fine     <td> 0x2   <td>0-255    <td>The fine (least significant) byte of the 16-bit intensity, for fixtures with 16-bit dimming.
+     *
+     * Intensity is stored at 16-bit resolution; the 8-bit channels are derived from it.
      */
     class intensity : public attribute {
-        /// A 0-255 value representing intensity (0-255 -> 0%-100%).
-        uint8_t m_intensity_value;
-
     public:
-        constexpr static attribute_channel normal = 0x1;
+        constexpr static attribute_channel normal    = 0x1;
+        constexpr static attribute_channel base_fine = 0x2;
+
+        /// Stored values: a 16-bit value representing intensity (0-65535 -> 0%-100%), coarse byte first.
+        constexpr static size_t value_size = 2;
 
-        intensity() :
-            attribute("intensity"),
-            m_intensity_value(0)
+        explicit intensity(attribute_store& a_store = attribute_store::default_store()) :
+            attribute("intensity", a_store, value_size)
         {}
 
         intensity(intensity const&) noexcept = delete;
@@ -72,6 +75,40 @@ namespace monet::channel::attribute {
          */
         void set_value(attribute_channel a_channel, uint8_t a_value) noexcept override;
 
+        /**
+         * @brief Get the value of an attribute channel at 16-bit resolution.
+         *
+         * @param a_channel The channel ID.
+         *
+         * @return The value of the channel, scaled to 0-65535.
+         *
+         * @note Overrides attribute::value_16().
+         */
+        [[nodiscard]]
+        uint16_t value_16(attribute_channel a_channel) const noexcept override;
+
+        /**
+         * @brief Set the value of an attribute channel at 16-bit resolution.
+         *
+         * @param a_channel The channel ID.
+         * @param a_value   The value to set the channel, scaled to 0-65535.
+         *
+         * @note Overrides attribute::set_value_16().
+         */
+        void set_value_16(attribute_channel a_channel, uint16_t a_value) noexcept override;
+
+        /**
+         * @brief Get where the value of a channel is stored, if it is stored verbatim.
+         *
+         * @param a_channel The channel ID.
+         *
+         * @return The offset of the coarse or fine byte, std::nullopt for derived channels.
+         *
+         * @note Overrides attribute::value_offset().
+         */
+        [[nodiscard]]
+        std::optional<size_t> value_offset(attribute_channel a_channel) const noexcept override;
+
         /**
          * @brief Get the internal intensity value of 0-255 -> 0%-100%.
          *
@@ -82,7 +119,17 @@ namespace monet::channel::attribute {
          */
         [[nodiscard]]
         uint8_t intensity_value() const noexcept {
-            return m_intensity_value;
+            return values()[0];
+        }
+
+        /**
+         * @brief Get the internal intensity value of 0-65535 -> 0%-100%.
+         *
+         * @return The internal intensity value at full resolution.
+         */
+        [[nodiscard]]
+        uint16_t intensity_value_16() const noexcept {
+            return load_16(0);
         }
 
         /**
@@ -94,7 +141,16 @@ namespace monet::channel::attribute {
          * more efficient than calling the virtual version, set_value("default", ...).
          */
         void set_intensity_value(uint8_t const a_value) noexcept {
-            m_intensity_value = a_value;
+            set_intensity_value_16(static_cast<uint16_t>(a_value * 257));
+        }
+
+        /**
+         * @brief Set the internal intensity value of 0-65535 -> 0%-100%.
+         *
+         * @param a_value The value to set the internal intensity value at full resolution.
+         */
+        void set_intensity_value_16(uint16_t const a_value) noexcept {
+            store_16(0, a_value);
         }
     };
 
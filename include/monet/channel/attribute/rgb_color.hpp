@@ -19,25 +19,27 @@ namespace monet::channel::attribute {
      *      <tr> <td>red           <td> 0x1   <td>0-255    <td>The red channel of the RGB color.
      *      <tr> <td>green         <td> 0x2   <td>0-255    <td>The green channel of the RGB color.
      *      <tr> <td>blue          <td> 0x3   <td>0-255    <td>The blue channel of the RGB color.
+     *      <tr> <td>red_fine      <td> 0x4   <td>0-255    <td>The fine (least significant) byte of the 16-bit red channel.
+     *      <tr> <td>green_fine    <td> 0x5   <td>0-255    <td>The fine (least significant) byte of the 16-bit green channel.
+     *      <tr> <td>blue_fine     <td> 0x6   <td>0-255    <td>The fine (least significant) byte of the 16-bit blue channel.
+     *
+     * Each color channel is stored at 16-bit resolution; the 8-bit channels are derived from it.
      */
     class rgb_color : public attribute {
-        /// The red channel of the RGB color.
-        uint8_t m_red;
-        /// The green channel of the RGB color.
-        uint8_t m_green;
-        /// The blue channel of the RGB color.
-        uint8_t m_blue;
-
     public:
         constexpr static attribute_channel red   = 0x1;
         constexpr static attribute_channel green = 0x2;
         constexpr static attribute_channel blue  = 0x3;
 
-        rgb_color() :
-            attribute("rgb_color"),
-            m_red(0),
-            m_blue(0),
-            m_green(0)
+        constexpr static attribute_channel red_fine   = 0x4;
+        constexpr static attribute_channel green_fine = 0x5;
+        constexpr static attribute_channel blue_fine  = 0x6;
+
+        /// Stored values: the 16-bit red, green, and blue channels of the RGB color, each coarse byte first.
+        constexpr static size_t value_size = 6;
+
+        explicit rgb_color(attribute_store& a_store = attribute_store::default_store()) :
+            attribute("rgb_color", a_store, value_size)
         {}
 
         rgb_color(rgb_color const&) noexcept = delete;
@@ -76,6 +78,41 @@ namespace monet::channel::attribute {
          */
         void set_value(attribute_channel a_channel, uint8_t a_value) noexcept override;
 
+        /**
+         * @brief Get the value of an attribute channel at 16-bit resolution.
+         *
+         * @param a_channel The channel ID.
+         *
+         * @return The value of the channel, scaled to 0-65535.
+         *
+         * @note Overrides attribute::value_16().
+         */
+        [[nodiscard]]
+        uint16_t value_16(attribute_channel a_channel) const noexcept override;
+
+        /**
+         * @brief Set the value of an attribute channel at 16-bit resolution.
+         *
+         * @param a_channel The channel ID.
+         * @param a_value   The value to set the channel, scaled to 0-65535.
+         *
+         * @note Overrides attribute::set_value_16().
+         */
+        void set_value_16(attribute_channel a_channel, uint16_t a_value) noexcept override;
+
+        /**
+         * @brief Get where the value of a channel is stored, if it is stored verbatim.
+         *
+         * @param a_channel The channel ID.
+         *
+         * @return The offset of the coarse or fine byte of the red, green, or blue value, std::nullopt for the base
+         *         channel.
+         *
+         * @note Overrides attribute::value_offset().
+         */
+        [[nodiscard]]
+        std::optional<size_t> value_offset(attribute_channel a_channel) const noexcept override;
+
         /**
          * @brief Get the value of the red channel of the RGB color.
          *
@@ -83,7 +120,7 @@ namespace monet::channel::attribute {
          */
         [[nodiscard]]
         uint8_t red_channel() const noexcept {
-            return m_red;
+            return values()[0];
         }
 
         /**
@@ -92,7 +129,7 @@ namespace monet::channel::attribute {
          * @param a_red The value to set the red channel of the RGB color.
          */
         void set_red_channel(uint8_t const a_red) noexcept {
-            m_red = a_red;
+            store_16(0, static_cast<uint16_t>(a_red * 257));
         }
 
         /**
@@ -102,7 +139,7 @@ namespace monet::channel::attribute {
          */
         [[nodiscard]]
         uint8_t green_channel() const noexcept {
-            return m_green;
+            return values()[2];
         }
 
         /**
@@ -111,7 +148,7 @@ namespace monet::channel::attribute {
          * @param a_green The value to set the green channel of the RGB color.
          */
         void set_green_channel(uint8_t const a_green) noexcept {
-            m_green = a_green;
+            store_16(2, static_cast<uint16_t>(a_green * 257));
         }
 
         /**
@@ -121,7 +158,7 @@ namespace monet::channel::attribute {
          */
         [[nodiscard]]
         uint8_t blue_channel() const noexcept {
-            return m_blue;
+            return values()[4];
         }
 
         /**
@@ -130,7 +167,7 @@ namespace monet::channel::attribute {
          * @param a_blue The value to set the blue channel of the RGB color.
          */
         void set_blue_channel(uint8_t const a_blue) noexcept {
-            m_blue = a_blue;
+            store_16(4, static_cast<uint16_t>(a_blue * 257));
         }
 
         /// Interface function to permit structured bindings.
@@ -21,7 +21,7 @@ namespace monet::channel {
         /// Name of the attribute in the context of a channel configuration.
         std::string m_name;
         /// Properties, including restrictions and other behavior, of the attribute.
-        std::map<std::string, std::string, std::equal_to<>> m_properties;
+        std::map<std::string, std::string, std::less<>> m_properties;
 
     public:
         /**
@@ -39,7 +39,7 @@ namespace monet::channel {
          * @param a_name The name of the attribute definition.
          * @param a_properties The initial property list of the attribute definition.
          */
-        attribute_definition(std::string a_name, std::map<std::string, std::string, std::equal_to<>> a_properties) noexcept :
+        attribute_definition(std::string a_name, std::map<std::string, std::string, std::less<>> a_properties) noexcept :
             m_name(std::move(a_name)),
             m_properties(std::move(a_properties))
         {}
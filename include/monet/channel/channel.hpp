@@ -15,6 +15,23 @@ namespace monet {
 }
 
 namespace monet::channel {
+    /**
+     * @brief An address mapping resolved against the attributes of a specific channel.
+     *
+     * Resolving the attribute type and channel name of a mapping involves string lookups, so they are resolved once
+     * into a render plan and the plan is walked for every render. Channels whose values are stored verbatim are read
+     * straight out of the attribute pool.
+     */
+    struct render_entry {
+        /// The attribute from which to select data or nullptr if the mapping does not resolve to an attribute.
+        attribute::attribute const* attribute;
+        /// The attribute channel from which to select data.
+        attribute_channel channel;
+        /// The value in the attribute pool or nullptr if the value must be read through attribute::value(). Pool
+        /// values never move, so the pointer stays valid while other attributes are created.
+        uint8_t const* value;
+    };
+
     /**
      * @brief Represents a channel with all of its attributes.
      */
@@ -28,8 +45,14 @@ namespace monet::channel {
 
         server* m_server;
         address::universe* m_universe;
+        size_t m_universe_number;
         size_t m_address;
 
+        /// Address mappings resolved to attribute pointers and channel IDs, in address order.
+        mutable std::vector<render_entry> m_render_plan;
+        /// The configuration revision from which the render plan was compiled.
+        mutable size_t m_render_plan_revision;
+
     public:
         /**
          * @brief Construct a channel based on a channel configuration.
@@ -43,7 +66,10 @@ namespace monet::channel {
             m_base_address(a_base_address),
             m_server(a_server),
             m_universe(nullptr),
-            m_address(0)
+            m_universe_number(0),
+            m_address(0),
+            m_render_plan(),
+            m_render_plan_revision(0)
         {
             propagate_attributes();
             find_universe();
@@ -163,22 +189,68 @@ namespace monet::channel {
             find_universe();
         }
 
+        /**
+         * @brief Get the number of the universe the channel outputs to.
+         *
+         * @return The universe number or 0 if the channel is not patched to a universe.
+         */
+        [[nodiscard]]
+        size_t universe_number() const noexcept {
+            return m_universe_number;
+        }
+
+        /**
+         * @brief Get the address of the channel within its universe.
+         *
+         * @return The address the first address mapping outputs to, or 0 if the channel is not patched to a universe.
+         */
+        [[nodiscard]]
+        size_t address() const noexcept {
+            return m_address;
+        }
+
         /**
          * @brief Generate attribute objects for all of the attributes defined in the configuration.
          *
          * Iterates through all of the attribute definitions in the configuration, retrieving the type and using it with
          * instantiate_attribute to dynamically construct an attribute object of said type and add it to m_attributes.
+         * Attribute values are allocated in the attribute store of the server, or the default store without a server.
          *
-         * @note Automatically called by the constructor, set_config, and similar functions.
+         * @note Automatically called by the constructor, set_config, and similar functions. Also compiles the render
+         * plan.
          */
         void propagate_attributes();
 
+        /**
+         * @brief Get the compiled render plan of the channel.
+         *
+         * @return One resolved entry per address mapping, in address order.
+         *
+         * @note The plan is recompiled first if the configuration has been modified since it was last compiled.
+         */
+        [[nodiscard]]
+        std::span<render_entry const> render_plan() const noexcept;
+
+        /**
+         * @brief Render the values of all the addresses into a buffer.
+         *
+         * @param a_destination The buffer to write the address values into, starting at the first address.
+         *
+         * @return The amount of address values written, at most the size of the destination.
+         *
+         * Walks the render plan to select data from specific channels of the channel's attributes. Does not allocate.
+         */
+        size_t render(std::span<uint8_t> a_destination) const noexcept;
+
         /**
          * @brief Fetch the values of all the addresses.
          *
          * @return The values of all the addresses.
          *
          * Uses the address mappings to select data from specific channels of the channel's attributes.
+         *
+         * @note Allocates a new buffer on each call and is meant for the API and debugging. Output goes through
+         * push_updates(), which renders directly into the universe.
          */
         [[nodiscard]]
         std::vector<uint8_t> fetch_address_values() const noexcept;
@@ -218,12 +290,20 @@ namespace monet::channel {
 
         /**
          * @brief Commit address value updates to the target universe.
+         *
+         * Renders the address values directly into the buffer of the target universe at the channel's address.
          */
         void push_updates() const;
 
     private:
-        /// Assign m_universe and m_address according to m_base_address;
+        /// Get the store attribute values are allocated in.
+        attribute::attribute_store& store() const noexcept;
+
+        /// Assign m_universe, m_universe_number, and m_address according to m_base_address;
         void find_universe();
+
+        /// Resolve the address mappings of the configuration into m_render_plan.
+        void compile_render_plan() const noexcept;
     };
 
 }
@@ -22,11 +22,13 @@
  * intensity
  *     (default) - 0 to 255
  *     normal - 0 to 100
+ *     base_fine - fine byte of 16-bit intensity (0-255)
  *
  * rgb_color
  *     r - red channel of RGB (0-255)
  *     g - green channel of RGB (0-255)
  *     b - blue channel of RGB (0-255)
+ *     red_fine/green_fine/blue_fine - fine byte of 16-bit RGB channel (0-255)
  *
  * integer
  *     (default) - 0 to 255 (clamped)
@@ -52,6 +54,8 @@ namespace monet::channel {
         std::vector<std::pair<std::string, std::vector<attribute_definition>>> m_attribute_definitions;
         /// Mappings of attribute channels to addresses, in order. Indices are offsets to the base channel address.
         std::vector<address_mapping> m_address_mappings;
+        /// Incremented whenever the attributes or address mappings may have been modified.
+        size_t m_revision = 0;
 
     public:
         configuration() :
@@ -83,6 +87,18 @@ namespace monet::channel {
             return m_name;
         }
 
+        /**
+         * @brief Get the revision of the configuration.
+         *
+         * @return A counter that changes whenever the attributes or address mappings may have been modified.
+         *
+         * Channels compare this against the revision their render plan was compiled from to know when to recompile.
+         */
+        [[nodiscard]]
+        size_t revision() const noexcept {
+            return m_revision;
+        }
+
         /**
          * @brief Get the total amount of attribute definitions.
          *
@@ -113,9 +129,12 @@ namespace monet::channel {
          * @brief Get all attribute definitions.
          *
          * @return All attribute definitions.
+         *
+         * @note Counts as a modification and increments the revision.
          */
         [[nodiscard]]
         auto& attributes() noexcept {
+            ++m_revision;
             return m_attribute_definitions;
         }
 
@@ -135,6 +154,9 @@ namespace monet::channel {
          * @param a_attribute_type The type of which attributes to return.
          *
          * @return The attribute definitions of the specified type.
+         *
+         * @note Does not count as a modification. Set properties through set_attribute_property() instead, so channels
+         * and the output stage pick them up.
          */
         [[nodiscard]]
         std::span<attribute_definition> attributes(std::string_view a_attribute_type) noexcept;
@@ -149,13 +171,30 @@ namespace monet::channel {
         [[nodiscard]]
         std::span<attribute_definition const> attributes(std::string_view a_attribute_type) const noexcept;
 
+        /**
+         * @brief Set a property of an attribute definition.
+         *
+         * @param a_attribute_type  The type of the attribute.
+         * @param a_attribute_index The index of the attribute within its type.
+         * @param a_property_name   The name of the property to set.
+         * @param a_property_value  The value to which to set the property.
+         *
+         * @return True if the property was set or false if no such attribute is defined.
+         *
+         * @note Counts as a modification and increments the revision.
+         */
+        bool set_attribute_property(std::string_view a_attribute_type, size_t a_attribute_index, std::string a_property_name, std::string a_property_value);
+
         /**
          * @brief Get all address mappings for the channel configuration.
          *
          * @return All address mappings for the channel configuration.
+         *
+         * @note Counts as a modification and increments the revision.
          */
         [[nodiscard]]
         auto& address_mappings() noexcept {
+            ++m_revision;
             return m_address_mappings;
         }
 
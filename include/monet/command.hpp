@@ -0,0 +1,55 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_COMMAND_HPP
+#define MASTER_SERVER_COMMAND_HPP
+
+#include <chrono>
+#include <string>
+
+#include "definitions.hpp"
+#include "fade_engine.hpp"
+
+namespace monet {
+
+    /**
+     * @brief A mutation queued by a control surface for the render thread to apply.
+     */
+    struct command {
+        enum class command_type : uint8_t {
+            /// Set the value of an attribute channel of a channel.
+            set_attribute_value,
+            /// Set the value of an address by master address.
+            set_address_value,
+            /// Go to the next cue of a cue stack.
+            go_cue,
+            /// Jump to a specific cue of a cue stack.
+            go_to_cue,
+            /// Set the grand master level.
+            set_grand_master
+        };
+
+        command_type type = command_type::set_attribute_value;
+        /// The channel number (set_attribute_value), master address (set_address_value), or cue stack index (go_cue,
+        /// go_to_cue).
+        size_t target = 0;
+        /// The attribute type (set_attribute_value).
+        std::string attribute_type;
+        /// The index of the attribute relative to attribute type (set_attribute_value).
+        size_t attribute_index = 0;
+        /// The attribute channel name (set_attribute_value).
+        std::string attribute_channel;
+        /// The value to set, or the grand master level (set_grand_master).
+        uint8_t value = 0;
+        /// The time to fade to the value over, or zero to set it immediately (set_attribute_value).
+        std::chrono::milliseconds fade_time{0};
+        /// The shape of the fade (set_attribute_value).
+        fade_curve curve = fade_curve::linear;
+        /// The cue index (go_to_cue).
+        size_t cue_index = 0;
+    };
+
+}
+
+#endif //MASTER_SERVER_COMMAND_HPP
@@ -0,0 +1,122 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_COMMAND_QUEUE_HPP
+#define MASTER_SERVER_COMMAND_QUEUE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+#include "definitions.hpp"
+
+namespace monet {
+
+    /**
+     * @brief A bounded, lock-free, multi-producer/single-consumer queue.
+     *
+     * Each cell carries a sequence number that tells producers whether the cell is free and the consumer whether it
+     * has been filled, so producers only contend on claiming a position and never block each other while copying
+     * their value in.
+     *
+     * @tparam t_value    The element type. Must be default constructible and move assignable.
+     * @tparam v_capacity The amount of cells. Must be a power of two.
+     */
+    template <typename t_value, size_t v_capacity>
+    class command_queue {
+        static_assert(v_capacity > 1 && (v_capacity & (v_capacity - 1)) == 0, "capacity must be a power of two");
+
+        struct cell {
+            std::atomic<size_t> sequence;
+            t_value value;
+        };
+
+        std::array<cell, v_capacity> m_cells;
+
+        /// Next position to be claimed by a producer.
+        alignas(cache_line_size) std::atomic<size_t> m_enqueue_position;
+        /// Next position to be read by the consumer.
+        alignas(cache_line_size) size_t m_dequeue_position;
+
+    public:
+        command_queue() :
+            m_enqueue_position(0),
+            m_dequeue_position(0)
+        {
+            for (size_t i = 0; i < v_capacity; ++i) {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        command_queue(command_queue const&) = delete;
+        command_queue(command_queue&&)      = delete;
+
+        command_queue& operator = (command_queue const&) = delete;
+        command_queue& operator = (command_queue&&)      = delete;
+
+        /**
+         * @brief Get the amount of cells in the queue.
+         */
+        [[nodiscard]]
+        constexpr static size_t capacity() noexcept {
+            return v_capacity;
+        }
+
+        /**
+         * @brief Add a value to the queue. Safe to call from any thread.
+         *
+         * @param a_value The value to add.
+         *
+         * @return True if the value was added or false if the queue is full.
+         */
+        bool enqueue(t_value a_value) noexcept {
+            auto position = m_enqueue_position.load(std::memory_order_relaxed);
+
+            for (;;) {
+                auto& target = m_cells[position % v_capacity];
+                auto const sequence = target.sequence.load(std::memory_order_acquire);
+                auto const difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+                if (difference == 0) {
+                    // Cell is free for this position; try to claim it.
+                    if (m_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        target.value = std::move(a_value);
+                        target.sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (difference < 0) {
+                    // Cell still holds a value from the previous lap.
+                    return false;
+                } else {
+                    position = m_enqueue_position.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Remove the oldest value from the queue. Consumer only.
+         *
+         * @param a_value Receives the value.
+         *
+         * @return True if a value was removed or false if the queue is empty.
+         */
+        bool dequeue(t_value& a_value) noexcept {
+            auto& target = m_cells[m_dequeue_position % v_capacity];
+
+            if (target.sequence.load(std::memory_order_acquire) != m_dequeue_position + 1) {
+                return false;
+            }
+
+            a_value = std::move(target.value);
+            target.sequence.store(m_dequeue_position + v_capacity, std::memory_order_release);
+            ++m_dequeue_position;
+
+            return true;
+        }
+    };
+
+}
+
+#endif //MASTER_SERVER_COMMAND_QUEUE_HPP
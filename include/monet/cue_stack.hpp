@@ -0,0 +1,209 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_CUE_STACK_HPP
+#define MASTER_SERVER_CUE_STACK_HPP
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "fade_engine.hpp"
+
+namespace monet {
+
+    /**
+     * @brief The value an attribute channel takes in a cue.
+     */
+    struct cue_value {
+        /// The channel owning the attribute.
+        channel::channel* channel;
+        /// The attribute.
+        channel::attribute::attribute* attribute;
+        /// The attribute channel.
+        channel::attribute_channel attribute_channel;
+        /// The target value, at 16-bit resolution.
+        uint16_t value;
+    };
+
+    /**
+     * @brief A recorded look: target values for a set of attribute channels and how to fade to them.
+     */
+    struct cue {
+        std::string name;
+        /// Target values. Attribute channels not listed keep the value of the previous cue (tracking).
+        std::vector<cue_value> values;
+        /// Time to fade to the cue.
+        std::chrono::steady_clock::duration fade_time = std::chrono::steady_clock::duration::zero();
+        fade_curve curve = fade_curve::linear;
+    };
+
+    /**
+     * @brief Plays back a list of cues in order.
+     *
+     * Cues track: an attribute channel keeps its value until a later cue changes it. When the list is compiled, the
+     * values of each cue that differ from the tracked state after the previous cue are precomputed into a delta, so
+     * GO only starts fades for what actually changes, without diffing the show.
+     *
+     * @note Not thread-safe. Played back by the render thread through the command queue.
+     */
+    class cue_stack {
+    public:
+        using clock = std::chrono::steady_clock;
+
+        /// Index of the current cue before the first GO.
+        constexpr static size_t npos = static_cast<size_t>(-1);
+
+    private:
+        std::string m_name;
+        std::vector<cue> m_cues;
+        /// Values of each cue differing from the tracked state after the previous cue.
+        std::vector<std::vector<cue_value>> m_deltas;
+        /// Whether m_deltas matches m_cues.
+        bool m_compiled;
+        /// Index of the cue last gone to, or npos.
+        size_t m_current;
+
+    public:
+        /**
+         * @brief Create an empty cue stack.
+         *
+         * @param a_name The name of the cue stack.
+         */
+        explicit cue_stack(std::string a_name = {}) :
+            m_name(std::move(a_name)),
+            m_cues(),
+            m_deltas(),
+            m_compiled(true),
+            m_current(npos)
+        {}
+
+        cue_stack(cue_stack const&) = delete;
+        cue_stack(cue_stack&&)      = delete;
+
+        cue_stack& operator = (cue_stack const&) = delete;
+        cue_stack& operator = (cue_stack&&)      = delete;
+
+        /**
+         * @brief Get the name of the cue stack.
+         */
+        [[nodiscard]]
+        std::string_view name() const noexcept {
+            return m_name;
+        }
+
+        /**
+         * @brief Append a cue.
+         *
+         * @param a_cue The cue.
+         *
+         * @return The cue, in the stack.
+         */
+        cue& add_cue(cue a_cue) {
+            m_compiled = false;
+            return m_cues.emplace_back(std::move(a_cue));
+        }
+
+        /**
+         * @brief Get the cues for modification.
+         *
+         * @return The cues.
+         *
+         * @note Marks the cue stack for recompilation.
+         */
+        [[nodiscard]]
+        std::vector<cue>& cues() noexcept {
+            m_compiled = false;
+            return m_cues;
+        }
+
+        /**
+         * @brief Get the cues.
+         */
+        [[nodiscard]]
+        std::vector<cue> const& cues() const noexcept {
+            return m_cues;
+        }
+
+        /**
+         * @brief Get the precomputed delta of a cue.
+         *
+         * @param a_index The cue index.
+         *
+         * @return The values of the cue that differ from the tracked state after the previous cue.
+         */
+        [[nodiscard]]
+        std::span<cue_value const> delta(size_t a_index);
+
+        /**
+         * @brief Get the index of the cue last gone to.
+         *
+         * @return The cue index or npos before the first GO.
+         */
+        [[nodiscard]]
+        size_t current() const noexcept {
+            return m_current;
+        }
+
+        /**
+         * @brief Precompute the delta of every cue.
+         *
+         * @note Happens automatically on the first GO after the cues are modified; call it after editing to keep that
+         * GO fast.
+         */
+        void compile();
+
+        /**
+         * @brief Go to the next cue, fading only the attribute channels that change.
+         *
+         * @param a_fades   The fade engine to start fades in.
+         * @param a_updated Receives the channels set immediately by cues without a fade time.
+         * @param a_now     The time of the GO.
+         *
+         * @return False if there is no next cue.
+         */
+        bool go(fade_engine& a_fades, std::vector<channel::channel*>& a_updated, clock::time_point a_now = clock::now());
+
+        /**
+         * @brief Jump to any cue, fading every attribute channel to its tracked state in that cue.
+         *
+         * @param a_index   The cue index.
+         * @param a_fades   The fade engine to start fades in.
+         * @param a_updated Receives the channels set immediately by cues without a fade time.
+         * @param a_now     The time of the jump.
+         *
+         * @return False if the index is out of range.
+         *
+         * @note Replays the tracked state of every cue up to the target, so it is slower than go().
+         */
+        bool go_to(
+            size_t a_index,
+            fade_engine& a_fades,
+            std::vector<channel::channel*>& a_updated,
+            clock::time_point a_now = clock::now()
+        );
+
+        /**
+         * @brief Remove every value belonging to a channel from every cue.
+         *
+         * @param a_channel The channel.
+         *
+         * @note Must be called before the channel or its attributes are destroyed.
+         */
+        void remove_channel(channel::channel const& a_channel);
+
+    private:
+        /// Start fades to a list of values with the timing of a cue.
+        static void apply(
+            std::span<cue_value const> a_values,
+            cue const& a_cue,
+            fade_engine& a_fades,
+            std::vector<channel::channel*>& a_updated,
+            clock::time_point a_now
+        );
+    };
+
+}
+
+#endif //MASTER_SERVER_CUE_STACK_HPP
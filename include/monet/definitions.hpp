@@ -6,15 +6,86 @@
 #define MASTER_SERVER_DEFINITIONS_HPP
 
 #include <cstdint>
+#include <chrono>
 
 namespace monet {
 
     constexpr size_t dmx_data_channel_count = 512;
     constexpr size_t universe_buffer_size = dmx_data_channel_count + 1;
 
+    /// The range of valid universe numbers (as per sACN).
+    constexpr size_t min_universe_number = 1;
+    constexpr size_t max_universe_number = 63999;
+
+    constexpr size_t cache_line_size = 64;
+
     constexpr uint16_t default_web_panel_port = 8080;
+    /// Amount of threads the web panel serves requests on. Every live feed subscriber holds one while connected.
+    constexpr size_t default_web_panel_threads = 64;
+    /// Amount of web panel threads kept free of live feed subscribers, so API requests are always served.
+    constexpr size_t web_panel_reserved_threads = 8;
+    /// Amount of events the live feed keeps for subscribers that fall behind or reconnect.
+    constexpr size_t live_feed_backlog = 256;
+    /// Interval at which idle live feed subscribers are sent a comment, so proxies keep the stream open.
+    constexpr std::chrono::milliseconds live_feed_keep_alive_interval{15000};
 
     constexpr size_t default_sink_framerate = 20;
+    constexpr size_t command_queue_capacity = 4096;
+    constexpr size_t default_render_threads = 1;
+    /// Amount of attribute slots allocated at once by an attribute pool. Slots never move once allocated.
+    constexpr size_t attribute_pool_chunk_slots = 1024;
+    /// Amount of simultaneous fades space is reserved for up front.
+    constexpr size_t default_fade_capacity = 1024;
+    /// Amount of effect members evaluated per task when an effect is spread over the render threads.
+    constexpr size_t effect_block_size = 1024;
+    /// Priority of merge sources and of the rendered universes unless set otherwise (the E1.31 default priority).
+    constexpr uint8_t default_merge_priority = 100;
+    /// Amount of remote sACN sources a receiver can merge at once.
+    constexpr size_t default_sacn_source_slots = 4;
+    /// Amount of packets a receiver takes from the socket per call.
+    constexpr size_t sacn_receive_batch_size = 32;
+    /// Longest a receive call blocks before the receiver checks for timeouts and stop requests.
+    constexpr std::chrono::milliseconds sacn_receive_poll_interval{100};
+    /// Time without packets after which a remote source is considered gone (E1.31 network data loss timeout).
+    constexpr std::chrono::milliseconds sacn_source_timeout{2500};
+    /// UDP port Art-Net nodes listen on.
+    constexpr uint16_t default_artnet_port = 6454;
+    /// Interval at which an Art-Net sink polls for nodes (Art-Net recommends 2.5-3s).
+    constexpr std::chrono::milliseconds artnet_poll_interval{2500};
+    /// Time without an ArtPollReply after which a discovered node is forgotten.
+    constexpr std::chrono::milliseconds artnet_node_timeout{10000};
+    /// Interval at which a recorder writes an index entry followed by every universe.
+    constexpr std::chrono::milliseconds recording_index_interval{1000};
+    /// Amount of records a recording file grows by whenever it fills up.
+    constexpr size_t recording_growth_records = 65536;
+    /// Interval between keyframes of a show file.
+    constexpr std::chrono::seconds show_keyframe_interval{10};
+    /// Minimum length of a run of one value stored as a run in a show file, rather than as literal values.
+    constexpr size_t show_min_run_length = 4;
+    /// Name of the POSIX shared memory segment universes are exported to.
+    constexpr char const* default_shared_universes_name = "/monet-universes";
+    /// Amount of frames the ring between the server and an out-of-process sink holds.
+    constexpr size_t process_host_ring_slots = 8;
+    /// Amount of universes a frame in the ring of an out-of-process sink holds.
+    constexpr size_t default_process_host_universes = 256;
+    /// Time without a heartbeat from an out-of-process sink after which it is killed and restarted.
+    constexpr std::chrono::milliseconds default_process_host_stall_timeout{1000};
+    /// Longest an out-of-process sink waits for a frame before it sends a heartbeat.
+    constexpr std::chrono::milliseconds process_host_heartbeat_interval{100};
+    /// Time an out-of-process sink is given to exit when stopped, before it is killed.
+    constexpr std::chrono::milliseconds process_host_stop_timeout{1000};
+    /// Time an out-of-process sink is given to create and initialize its hosted sink when first started.
+    constexpr std::chrono::milliseconds process_host_start_timeout{5000};
+    /// Delay before restarting an out-of-process sink that failed soon after it was started, doubled on each failure.
+    constexpr std::chrono::milliseconds process_host_min_restart_delay{10};
+    /// Longest delay before restarting an out-of-process sink. A child running this long counts as healthy again.
+    constexpr std::chrono::milliseconds process_host_max_restart_delay{5000};
+    constexpr std::chrono::microseconds default_frame_spin_time{2000};
+
+    /// Interval at which unchanged universes are resent (E1.31 recommends 800-1000ms).
+    constexpr std::chrono::milliseconds default_sink_keep_alive_interval{800};
+    /// Amount of times a universe is resent at the framerate after it stops changing (E1.31 recommends 3).
+    constexpr size_t default_sink_unchanged_repeats = 3;
 
     namespace channel {
 
@@ -0,0 +1,351 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_EFFECT_ENGINE_HPP
+#define MASTER_SERVER_EFFECT_ENGINE_HPP
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "channel/channel.hpp"
+#include "definitions.hpp"
+#include "worker_pool.hpp"
+
+namespace monet {
+
+    /**
+     * @brief The waveform an effect drives its members with.
+     */
+    enum class effect_waveform : uint8_t {
+        /// Smooth oscillation between the low and high values.
+        sine,
+        /// Linear ramp up to the high value and back down.
+        triangle,
+        /// The high value for the duty cycle of each period, the low value otherwise.
+        square,
+        /// A new random value between the low and high values every frame (flicker).
+        noise
+    };
+
+    /**
+     * @brief An attribute channel driven by an effect.
+     */
+    struct effect_member {
+        /// The channel owning the attribute, re-rendered every frame the effect runs.
+        channel::channel* channel;
+        /// The attribute being driven.
+        channel::attribute::attribute* attribute;
+        /// The attribute channel being driven.
+        channel::attribute_channel attribute_channel;
+    };
+
+    /**
+     * @brief A parametric effect driving a list of attribute channels with a waveform.
+     *
+     * Every member runs the same waveform, offset in phase by its position in the member list times the spread, so a
+     * spread of 1 / member count chases the waveform across the members once per period. Values are computed for all
+     * members at once by tight loops over contiguous arrays of phase offsets and noise states, and then written to the
+     * attributes at 16-bit resolution.
+     */
+    class effect {
+    public:
+        using clock = std::chrono::steady_clock;
+
+    private:
+        effect_waveform m_waveform;
+        /// Periods per second.
+        float m_rate;
+        /// Phase offset between consecutive members, in periods.
+        float m_spread;
+        /// Portion of each period the square waveform is high.
+        float m_duty;
+        /// The value at the bottom of the waveform, at 16-bit resolution.
+        uint16_t m_low;
+        /// The value at the top of the waveform, at 16-bit resolution.
+        uint16_t m_high;
+        /// Time the waveform starts its first period.
+        clock::time_point m_start_time;
+
+        std::vector<effect_member> m_members;
+        /// Phase offset of each member, in periods.
+        std::vector<float> m_phase_offsets;
+        /// Random generator state of each member.
+        std::vector<uint32_t> m_noise_states;
+        /// Value of each member computed in the last evaluation.
+        std::vector<uint16_t> m_values;
+        /// Each channel with a member, once.
+        std::vector<channel::channel*> m_channels;
+
+        /// Time the last evaluation took.
+        clock::duration m_cost;
+
+    public:
+        /**
+         * @brief Create an effect without members.
+         *
+         * @param a_waveform The waveform.
+         * @param a_rate     Periods per second.
+         * @param a_low      The value at the bottom of the waveform, at 16-bit resolution.
+         * @param a_high     The value at the top of the waveform, at 16-bit resolution.
+         * @param a_spread   The phase offset between consecutive members, in periods.
+         */
+        explicit effect(
+            effect_waveform const a_waveform = effect_waveform::sine,
+            float const a_rate = 1.0f,
+            uint16_t const a_low = 0,
+            uint16_t const a_high = 65535,
+            float const a_spread = 0.0f
+        ) noexcept :
+            m_waveform(a_waveform),
+            m_rate(a_rate),
+            m_spread(a_spread),
+            m_duty(0.5f),
+            m_low(a_low),
+            m_high(a_high),
+            m_start_time(clock::now()),
+            m_cost(clock::duration::zero())
+        {}
+
+        effect(effect const&) = delete;
+        effect(effect&&)      = delete;
+
+        effect& operator = (effect const&) = delete;
+        effect& operator = (effect&&)      = delete;
+
+        /**
+         * @brief Add an attribute channel to the end of the member list.
+         *
+         * @param a_channel           The channel owning the attribute.
+         * @param a_attribute         The attribute.
+         * @param a_attribute_channel The attribute channel.
+         *
+         * @note Every member must be a distinct attribute channel, as members may be written from different threads.
+         */
+        void add_member(
+            channel::channel& a_channel,
+            channel::attribute::attribute& a_attribute,
+            channel::attribute_channel a_attribute_channel
+        );
+
+        /**
+         * @brief Remove every member belonging to a channel.
+         *
+         * @param a_channel The channel.
+         */
+        void remove_channel(channel::channel const& a_channel);
+
+        /**
+         * @brief Get the members, in chase order.
+         */
+        [[nodiscard]]
+        std::span<effect_member const> members() const noexcept {
+            return m_members;
+        }
+
+        /**
+         * @brief Get each channel with a member, once.
+         */
+        [[nodiscard]]
+        std::span<channel::channel* const> channels() const noexcept {
+            return m_channels;
+        }
+
+        /**
+         * @brief Get the values computed for each member by the last evaluation, at 16-bit resolution.
+         */
+        [[nodiscard]]
+        std::span<uint16_t const> values() const noexcept {
+            return m_values;
+        }
+
+        /**
+         * @brief Get the waveform.
+         */
+        [[nodiscard]]
+        effect_waveform waveform() const noexcept {
+            return m_waveform;
+        }
+
+        /**
+         * @brief Set the waveform.
+         *
+         * @param a_waveform The new waveform.
+         */
+        void set_waveform(effect_waveform const a_waveform) noexcept {
+            m_waveform = a_waveform;
+        }
+
+        /**
+         * @brief Get the speed of the effect in periods per second.
+         */
+        [[nodiscard]]
+        float rate() const noexcept {
+            return m_rate;
+        }
+
+        /**
+         * @brief Set the speed of the effect.
+         *
+         * @param a_rate Periods per second.
+         */
+        void set_rate(float const a_rate) noexcept {
+            m_rate = a_rate;
+        }
+
+        /**
+         * @brief Get the phase offset between consecutive members, in periods.
+         */
+        [[nodiscard]]
+        float spread() const noexcept {
+            return m_spread;
+        }
+
+        /**
+         * @brief Set the phase offset between consecutive members.
+         *
+         * @param a_spread The offset in periods; 0 runs every member in unison.
+         */
+        void set_spread(float a_spread);
+
+        /**
+         * @brief Get the portion of each period the square waveform is high.
+         */
+        [[nodiscard]]
+        float duty() const noexcept {
+            return m_duty;
+        }
+
+        /**
+         * @brief Set the portion of each period the square waveform is high.
+         *
+         * @param a_duty The duty cycle from 0 to 1.
+         */
+        void set_duty(float const a_duty) noexcept {
+            m_duty = a_duty;
+        }
+
+        /**
+         * @brief Set the range of the waveform.
+         *
+         * @param a_low  The value at the bottom of the waveform, at 16-bit resolution.
+         * @param a_high The value at the top of the waveform, at 16-bit resolution.
+         */
+        void set_range(uint16_t const a_low, uint16_t const a_high) noexcept {
+            m_low = a_low;
+            m_high = a_high;
+        }
+
+        /**
+         * @brief Restart the waveform from the start of its first period.
+         *
+         * @param a_now The new start time.
+         */
+        void restart(clock::time_point const a_now = clock::now()) noexcept {
+            m_start_time = a_now;
+        }
+
+        /**
+         * @brief Get the time the last evaluation took.
+         */
+        [[nodiscard]]
+        clock::duration cost() const noexcept {
+            return m_cost;
+        }
+
+        /**
+         * @brief Compute the value of every member and write it into its attribute.
+         *
+         * @param a_now  The time of the frame.
+         * @param a_pool The pool to spread large member lists over.
+         */
+        void evaluate(clock::time_point a_now, worker_pool& a_pool);
+
+    private:
+        /// Compute and write the values of the members in [a_first, a_last).
+        void evaluate_block(float a_phase, size_t a_first, size_t a_last) noexcept;
+
+        /// Recompute the phase offset of every member from the spread.
+        void compute_phase_offsets() noexcept;
+    };
+
+    /**
+     * @brief Runs every effect once per frame.
+     *
+     * @note Not thread-safe. Owned and run by the render thread.
+     */
+    class effect_engine {
+        std::vector<std::unique_ptr<effect>> m_effects;
+        /// Time the last frame of effects took in total.
+        effect::clock::duration m_cost;
+
+    public:
+        effect_engine() :
+            m_effects(),
+            m_cost(effect::clock::duration::zero())
+        {}
+
+        effect_engine(effect_engine const&) = delete;
+        effect_engine(effect_engine&&)      = delete;
+
+        effect_engine& operator = (effect_engine const&) = delete;
+        effect_engine& operator = (effect_engine&&)      = delete;
+
+        /**
+         * @brief Create an effect.
+         *
+         * @param a_args Arguments forwarded to the effect constructor.
+         *
+         * @return The effect, owned by the engine.
+         */
+        template <typename... t_args>
+        effect& create(t_args&&... a_args) {
+            return *m_effects.emplace_back(std::make_unique<effect>(std::forward<t_args>(a_args)...));
+        }
+
+        /**
+         * @brief Stop and destroy an effect, leaving its members at their current values.
+         *
+         * @param a_effect The effect.
+         */
+        void destroy(effect const& a_effect) noexcept;
+
+        /**
+         * @brief Remove a channel from every effect.
+         *
+         * @param a_channel The channel.
+         *
+         * @note Must be called before the channel or its attributes are destroyed.
+         */
+        void remove_channel(channel::channel const& a_channel);
+
+        /**
+         * @brief Evaluate every effect.
+         *
+         * @param a_now     The time of the frame.
+         * @param a_pool    The pool to spread large member lists over.
+         * @param a_updated Receives each channel driven by an effect.
+         */
+        void advance(effect::clock::time_point a_now, worker_pool& a_pool, std::vector<channel::channel*>& a_updated);
+
+        /**
+         * @brief Get the effects.
+         */
+        [[nodiscard]]
+        std::span<std::unique_ptr<effect> const> effects() const noexcept {
+            return m_effects;
+        }
+
+        /**
+         * @brief Get the time the last frame of effects took in total.
+         */
+        [[nodiscard]]
+        effect::clock::duration cost() const noexcept {
+            return m_cost;
+        }
+    };
+
+}
+
+#endif //MASTER_SERVER_EFFECT_ENGINE_HPP
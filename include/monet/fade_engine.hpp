@@ -0,0 +1,194 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_FADE_ENGINE_HPP
+#define MASTER_SERVER_FADE_ENGINE_HPP
+
+#include <bit>
+#include <chrono>
+#include <vector>
+
+#include "channel/channel.hpp"
+#include "definitions.hpp"
+
+namespace monet {
+
+    /**
+     * @brief The shape of a fade over its duration.
+     */
+    enum class fade_curve : uint8_t {
+        /// Constant rate of change.
+        linear,
+        /// Starts slow and speeds up.
+        ease_in,
+        /// Starts fast and slows down.
+        ease_out,
+        /// Starts and ends slow (smoothstep).
+        ease_in_out
+    };
+
+    /**
+     * @brief An attribute channel moving from one value to another over time.
+     */
+    struct fade {
+        /// The channel owning the attribute, re-rendered while the fade runs.
+        channel::channel* channel;
+        /// The attribute being faded.
+        channel::attribute::attribute* attribute;
+        /// The attribute channel being faded.
+        channel::attribute_channel attribute_channel;
+        /// When the fade started.
+        std::chrono::steady_clock::time_point start_time;
+        /// How long the fade takes.
+        std::chrono::steady_clock::duration duration;
+        /// The value at the start of the fade, at 16-bit resolution.
+        uint16_t start_value;
+        /// The value at the end of the fade, at 16-bit resolution.
+        uint16_t target_value;
+        fade_curve curve;
+    };
+
+    /**
+     * @brief Advances every active fade once per frame.
+     *
+     * Fades run at 16-bit resolution so slow fades do not visibly step on fixtures with fine channels, and are
+     * evaluated in fixed-point. Fades are kept in a single compact array. Each frame, every fade writes its current
+     * value into its attribute and queues its channel for rendering; channels without an active fade are not touched.
+     * Finished fades are retired by moving the last fade into their place, and fades are found through a flat
+     * open-addressing index, so neither reallocates once they have grown to the amount of simultaneous fades.
+     * @note Not thread-safe. Owned and advanced by the render thread.
+     */
+    class fade_engine {
+    public:
+        using clock = std::chrono::steady_clock;
+
+    private:
+        /// An entry of the fade index. Empty entries have no attribute.
+        struct fade_slot {
+            channel::attribute::attribute const* attribute = nullptr;
+            channel::attribute_channel attribute_channel = 0;
+            /// Index into m_fades of the fade running on the attribute channel.
+            uint32_t index = 0;
+        };
+
+        std::vector<fade> m_fades;
+        /**
+         * Open-addressing index of the fade running on each attribute channel, so starting a fade stays O(1). Kept at
+         * most half full and only grows along with m_fades, so starting, cancelling and retiring fades never allocate.
+         */
+        std::vector<fade_slot> m_fade_slots;
+
+    public:
+        fade_engine() :
+            m_fade_slots(std::bit_ceil(default_fade_capacity * 2))
+        {
+            m_fades.reserve(default_fade_capacity);
+        }
+
+        fade_engine(fade_engine const&) = delete;
+        fade_engine(fade_engine&&)      = delete;
+
+        fade_engine& operator = (fade_engine const&) = delete;
+        fade_engine& operator = (fade_engine&&)      = delete;
+
+        /**
+         * @brief Start fading an attribute channel from its current value to a target value.
+         *
+         * @param a_channel           The channel owning the attribute.
+         * @param a_attribute         The attribute to fade.
+         * @param a_attribute_channel The attribute channel to fade.
+         * @param a_target_value      The value to fade to, at 16-bit resolution (0-65535).
+         * @param a_duration          How long the fade takes. Non-positive durations set the value immediately.
+         * @param a_curve             The shape of the fade.
+         * @param a_now               The start time of the fade.
+         *
+         * @return True if a fade was started, false if the value was set immediately.
+         *
+         * Replaces any fade already running on the same attribute channel, starting from wherever it got to.
+         */
+        bool start(
+            channel::channel& a_channel,
+            channel::attribute::attribute& a_attribute,
+            channel::attribute_channel a_attribute_channel,
+            uint16_t a_target_value,
+            clock::duration a_duration,
+            fade_curve a_curve = fade_curve::linear,
+            clock::time_point a_now = clock::now()
+        );
+
+        /**
+         * @brief Stop the fade running on an attribute channel, leaving it at its current value.
+         *
+         * @param a_attribute         The attribute.
+         * @param a_attribute_channel The attribute channel.
+         */
+        void cancel(channel::attribute::attribute const& a_attribute, channel::attribute_channel a_attribute_channel) noexcept;
+
+        /**
+         * @brief Stop every fade running on the attributes of a channel.
+         *
+         * @param a_channel The channel.
+         *
+         * @note Must be called before the channel or its attributes are destroyed.
+         */
+        void cancel(channel::channel const& a_channel) noexcept;
+
+        /**
+         * @brief Write the current value of every fade and retire the fades that have finished.
+         *
+         * @param a_now     The time of the frame.
+         * @param a_updated Receives the channel of every fade advanced, possibly more than once per channel.
+         */
+        void advance(clock::time_point a_now, std::vector<channel::channel*>& a_updated);
+
+        /**
+         * @brief Get the amount of active fades.
+         */
+        [[nodiscard]]
+        size_t size() const noexcept {
+            return m_fades.size();
+        }
+
+        /**
+         * @brief Get the active fades.
+         */
+        [[nodiscard]]
+        std::span<fade const> fades() const noexcept {
+            return m_fades;
+        }
+
+        /**
+         * @brief Calculate the value of a fade at a point in time.
+         *
+         * @param a_fade The fade.
+         * @param a_now  The point in time.
+         *
+         * @return The value at 16-bit resolution, clamped to the target value once the fade has finished.
+         */
+        [[nodiscard]]
+        static uint16_t evaluate(fade const& a_fade, clock::time_point a_now) noexcept;
+
+    private:
+        /// Retire the fade at an index by moving the last fade into its place.
+        void retire(size_t a_index) noexcept;
+
+        [[nodiscard]]
+        static size_t slot_hash(channel::attribute::attribute const* a_attribute, channel::attribute_channel a_attribute_channel) noexcept {
+            return (reinterpret_cast<uintptr_t>(a_attribute) ^ a_attribute_channel) * 0x9E3779B97F4A7C15ull >> 16;
+        }
+
+        /// Get the index slot of an attribute channel, or the empty slot it would be inserted into.
+        [[nodiscard]]
+        size_t find_slot(channel::attribute::attribute const* a_attribute, channel::attribute_channel a_attribute_channel) const noexcept;
+
+        /// Empty an index slot, shifting back the slots probed past it.
+        void erase_slot(size_t a_slot) noexcept;
+
+        /// Double the index, keeping it at most half full.
+        void grow_slots();
+    };
+
+}
+
+#endif //MASTER_SERVER_FADE_ENGINE_HPP
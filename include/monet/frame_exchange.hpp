@@ -0,0 +1,182 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_FRAME_EXCHANGE_HPP
+#define MASTER_SERVER_FRAME_EXCHANGE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "definitions.hpp"
+
+namespace monet {
+
+    /**
+     * @brief A lock-free set of reusable slots passing the newest value from one producer to any amount of consumers.
+     *
+     * The producer acquires a slot no consumer holds, fills it in place, and publishes it as the newest. Each
+     * consumer holds on to the newest slot it has acquired for as long as it reads it, independently of the others,
+     * so a slow consumer only ever misses values and never holds up the producer or the other consumers. With at
+     * least two more slots than consumers, a free slot is always available to the producer.
+     *
+     * Slots are never copied or reallocated, so their contents (and allocations) are reused.
+     *
+     * @tparam t_value The slot type.
+     */
+    template <typename t_value>
+    class frame_exchange {
+    public:
+        /// Slot index returned when no slot is available.
+        constexpr static size_t npos = std::numeric_limits<size_t>::max();
+
+    private:
+        struct slot {
+            t_value value{};
+            /// Amount of consumers holding the slot.
+            alignas(cache_line_size) std::atomic<size_t> readers{0};
+        };
+
+        std::unique_ptr<slot[]> m_slots;
+        size_t m_capacity;
+
+        /// Index of the slot being written. Producer only.
+        size_t m_write_slot;
+        /// Index of the newest published slot, or npos if none has been published.
+        alignas(cache_line_size) std::atomic<size_t> m_latest;
+
+    public:
+        /**
+         * @brief Create an exchange.
+         *
+         * @param a_capacity The amount of slots. At least two more than the amount of consumers.
+         */
+        explicit frame_exchange(size_t const a_capacity = 2) :
+            m_slots(std::make_unique<slot[]>(a_capacity)),
+            m_capacity(a_capacity),
+            m_write_slot(0),
+            m_latest(npos)
+        {}
+
+        frame_exchange(frame_exchange const&) = delete;
+        frame_exchange(frame_exchange&&)      = delete;
+
+        frame_exchange& operator = (frame_exchange const&) = delete;
+        frame_exchange& operator = (frame_exchange&&)      = delete;
+
+        /**
+         * @brief Get the amount of slots.
+         */
+        [[nodiscard]]
+        size_t capacity() const noexcept {
+            return m_capacity;
+        }
+
+        /**
+         * @brief Replace every slot with an amount of empty slots.
+         *
+         * @param a_capacity The new amount of slots.
+         *
+         * @note No consumer may hold a slot, and neither side may be in use concurrently.
+         */
+        void resize(size_t const a_capacity) {
+            m_slots = std::make_unique<slot[]>(a_capacity);
+            m_capacity = a_capacity;
+            m_write_slot = 0;
+            m_latest.store(npos, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Acquire a slot for writing. Producer only.
+         *
+         * @return A pointer to the slot, holding whatever it was last published with, or nullptr if every slot other
+         *         than the newest is held by a consumer.
+         */
+        [[nodiscard]]
+        t_value* try_acquire_write() noexcept {
+            auto const latest = m_latest.load(std::memory_order_relaxed);
+
+            // Start after the slot written last so slots are reused in turn.
+            for (size_t i = 1; i <= m_capacity; ++i) {
+                auto const index = (m_write_slot + i) % m_capacity;
+
+                // Pairs with the increment and recheck in try_acquire_read(): either the consumer's increment is seen
+                // here, or the consumer sees that the slot is no longer the newest and backs off.
+                if (index != latest && m_slots[index].readers.load(std::memory_order_seq_cst) == 0) {
+                    m_write_slot = index;
+                    return &m_slots[index].value;
+                }
+            }
+
+            return nullptr;
+        }
+
+        /**
+         * @brief Publish the slot acquired with try_acquire_write() as the newest. Producer only.
+         */
+        void publish() noexcept {
+            m_latest.store(m_write_slot, std::memory_order_seq_cst);
+        }
+
+        /**
+         * @brief Get the index of the newest published slot.
+         *
+         * @return The slot index, or npos if nothing has been published.
+         */
+        [[nodiscard]]
+        size_t latest() const noexcept {
+            return m_latest.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Acquire the newest published slot for reading. Consumer only.
+         *
+         * @return The index of the slot, or npos if nothing has been published. Must be given back with release().
+         */
+        [[nodiscard]]
+        size_t try_acquire_read() noexcept {
+            while (true) {
+                auto const index = m_latest.load(std::memory_order_seq_cst);
+
+                if (index == npos) {
+                    return npos;
+                }
+
+                m_slots[index].readers.fetch_add(1, std::memory_order_seq_cst);
+
+                // The producer may have moved on and started rewriting the slot before it saw this consumer.
+                if (m_latest.load(std::memory_order_seq_cst) == index) {
+                    return index;
+                }
+
+                m_slots[index].readers.fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        /**
+         * @brief Read a slot acquired with try_acquire_read(). Consumer only.
+         *
+         * @param a_index The slot index.
+         *
+         * @return The slot contents.
+         */
+        [[nodiscard]]
+        t_value const& read(size_t const a_index) const noexcept {
+            return m_slots[a_index].value;
+        }
+
+        /**
+         * @brief Give a slot acquired with try_acquire_read() back to the producer. Consumer only.
+         *
+         * @param a_index The slot index.
+         */
+        void release(size_t const a_index) noexcept {
+            m_slots[a_index].readers.fetch_sub(1, std::memory_order_release);
+        }
+    };
+
+}
+
+#endif //MASTER_SERVER_FRAME_EXCHANGE_HPP
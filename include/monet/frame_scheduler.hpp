@@ -0,0 +1,148 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_FRAME_SCHEDULER_HPP
+#define MASTER_SERVER_FRAME_SCHEDULER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "definitions.hpp"
+
+namespace monet {
+
+    /**
+     * @brief Paces a thread to a fixed framerate.
+     *
+     * Deadlines are laid out on a fixed grid (previous deadline + frame time) rather than relative to when the
+     * previous frame finished, so frames do not slip over time. Waiting sleeps until shortly before the deadline and
+     * spins only for the remainder, leaving the core free for other threads for most of the frame.
+     */
+    class frame_scheduler {
+    public:
+        using clock = std::chrono::steady_clock;
+
+    private:
+        /// Length of one frame in nanoseconds.
+        std::atomic<int64_t> m_frame_time;
+        /// Portion of the frame before the deadline spent spinning instead of sleeping.
+        clock::duration m_spin_time;
+        /// The deadline of the next frame.
+        clock::time_point m_next_deadline;
+        /// Amount of frames that have been scheduled since the last reset.
+        std::atomic<size_t> m_frame_count;
+        /// Amount of deadlines that passed entirely without a frame since the last reset.
+        std::atomic<size_t> m_missed_frames;
+
+    public:
+        /**
+         * @brief Create a frame scheduler.
+         *
+         * @param a_framerate The amount of frames per second.
+         */
+        explicit frame_scheduler(size_t const a_framerate = default_sink_framerate) noexcept :
+            m_frame_time(static_cast<int64_t>(std::nano::den / a_framerate)),
+            m_spin_time(default_frame_spin_time),
+            m_next_deadline(clock::now()),
+            m_frame_count(0),
+            m_missed_frames(0)
+        {}
+
+        frame_scheduler(frame_scheduler const&) = delete;
+        frame_scheduler(frame_scheduler&&)      = delete;
+
+        frame_scheduler& operator = (frame_scheduler const&) = delete;
+        frame_scheduler& operator = (frame_scheduler&&)      = delete;
+
+        /**
+         * @brief Restart the schedule with the next deadline one frame from now and clear the counters.
+         *
+         * @param a_phase Additional delay of every deadline, to offset the schedule from another one at the same
+         *                framerate.
+         */
+        void reset(clock::duration a_phase = clock::duration::zero()) noexcept;
+
+        /**
+         * @brief Block until the next frame deadline.
+         *
+         * Sleeps until the spin time before the deadline and then spins until the deadline is reached. If the
+         * deadline has already passed, returns immediately and counts any whole frames that were skipped.
+         */
+        void wait() noexcept;
+
+        /**
+         * @brief Get the framerate.
+         *
+         * @return The amount of frames per second.
+         */
+        [[nodiscard]]
+        size_t framerate() const noexcept {
+            return std::nano::den / m_frame_time.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Set the framerate.
+         *
+         * @param a_framerate The new amount of frames per second.
+         *
+         * @note Takes effect from the next scheduled deadline.
+         */
+        void set_framerate(size_t const a_framerate) noexcept {
+            m_frame_time.store(static_cast<int64_t>(std::nano::den / a_framerate), std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Get the length of one frame.
+         *
+         * @return The frame time.
+         */
+        [[nodiscard]]
+        std::chrono::nanoseconds frame_time() const noexcept {
+            return std::chrono::nanoseconds(m_frame_time.load(std::memory_order_relaxed));
+        }
+
+        /**
+         * @brief Get the portion of a frame spent spinning before the deadline.
+         *
+         * @return The spin time.
+         */
+        [[nodiscard]]
+        clock::duration spin_time() const noexcept {
+            return m_spin_time;
+        }
+
+        /**
+         * @brief Set the portion of a frame spent spinning before the deadline.
+         *
+         * @param a_spin_time The new spin time. Should cover the sleep granularity of the platform.
+         */
+        void set_spin_time(clock::duration const a_spin_time) noexcept {
+            m_spin_time = a_spin_time;
+        }
+
+        /**
+         * @brief Get the amount of frames scheduled since the last reset.
+         *
+         * @return The frame count.
+         */
+        [[nodiscard]]
+        size_t frame_count() const noexcept {
+            return m_frame_count.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Get the amount of frame deadlines missed since the last reset.
+         *
+         * @return The missed frame count.
+         */
+        [[nodiscard]]
+        size_t missed_frames() const noexcept {
+            return m_missed_frames.load(std::memory_order_relaxed);
+        }
+    };
+
+}
+
+#endif //MASTER_SERVER_FRAME_SCHEDULER_HPP
@@ -0,0 +1,34 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_FRAME_SNAPSHOT_HPP
+#define MASTER_SERVER_FRAME_SNAPSHOT_HPP
+
+#include <chrono>
+#include <vector>
+
+#include "address/universe.hpp"
+
+namespace monet {
+
+    /**
+     * @brief An immutable copy of every universe as rendered for one frame.
+     *
+     * Universes are stored in universe table slot order, so a slot index refers to the same universe in the table
+     * and in every snapshot.
+     */
+    struct frame_snapshot {
+        /// The index of the frame the snapshot was rendered for.
+        uint64_t frame_index = 0;
+        /// When the frame was rendered.
+        std::chrono::steady_clock::time_point time{};
+        /// Universe number for each slot.
+        std::vector<uint16_t> universe_numbers;
+        /// Universe data for each slot.
+        std::vector<address::universe> universes;
+    };
+
+}
+
+#endif //MASTER_SERVER_FRAME_SNAPSHOT_HPP
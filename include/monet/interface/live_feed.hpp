@@ -0,0 +1,217 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_LIVE_FEED_HPP
+#define MASTER_SERVER_LIVE_FEED_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "../definitions.hpp"
+
+namespace monet {
+    class server;
+}
+
+namespace monet::channel {
+    class channel;
+}
+
+namespace monet::interface {
+
+    /**
+     * @brief Pushes the attribute values of changed channels to web panel subscribers as Server-Sent Events.
+     *
+     * The render thread captures the attribute values of every channel it renders. Captures of a channel are
+     * coalesced until they are published, so a subscriber only ever sees the latest values. Publishing serializes
+     * the values that differ from the ones last published into a single event, numbered with a sequence, which every
+     * subscriber is handed as is: the cost of a frame does not grow with the amount of subscribers.
+     *
+     * Delta events have the shape {"sequence": n, "frame": n, "channels": {"<channel>": {"<type>": [{"<attribute
+     * channel>": value}, ...]}}}, the same shape as the attributes of a POST /api/channel request, with null for the
+     * attributes of a type that did not change. A resync event tells the subscriber to fetch the complete state from
+     * GET /api/channels instead, then apply the deltas that follow it. Subscribers that fall behind or reconnect
+     * catch up from a bounded backlog of events, or are told to resync once it no longer reaches back far enough. A
+     * channel that was deleted is sent once as null.
+     *
+     * Nothing is captured while there are no subscribers.
+     */
+    class live_feed {
+    public:
+        /// A serialized event, shared by every subscriber.
+        struct event {
+            /// The sequence number of the event, sent as its ID.
+            uint64_t sequence;
+            /// The complete event, ready to be written to the stream.
+            std::string message;
+        };
+
+    private:
+        /// The value of an attribute channel of a channel.
+        struct attribute_value {
+            std::string_view type;
+            size_t index;
+            std::string_view channel;
+            uint8_t value;
+        };
+
+        /// The values of a channel, as last captured.
+        struct channel_values {
+            std::vector<attribute_value> values;
+            /// Whether the values have been captured since they were last published.
+            bool pending;
+        };
+
+        std::atomic<size_t> m_subscribers;
+        std::atomic_bool m_stopping;
+        std::thread m_thread;
+
+        /// Guards the captured values, shared by the render thread and the publishing thread.
+        std::mutex m_capture_mutex;
+        std::condition_variable m_capture_condition;
+        std::unordered_map<size_t, channel_values> m_captured;
+        /// Channels captured since the last publish, in the order they were first captured.
+        std::vector<size_t> m_pending_channels;
+        /// Channels deleted since the last publish.
+        std::vector<size_t> m_removed_channels;
+        /// The frame the pending values were last captured in.
+        uint64_t m_pending_frame;
+        /// Whether values were not captured for a while, so the values last published can no longer be compared to.
+        bool m_published_stale;
+
+        /// Values taken from the captured values by the publishing thread.
+        std::vector<std::pair<size_t, std::vector<attribute_value>>> m_batch;
+        /// Deleted channels taken by the publishing thread.
+        std::vector<size_t> m_removed_batch;
+        /// Values of every channel as last published. Publishing thread only.
+        std::unordered_map<size_t, std::vector<attribute_value>> m_published;
+
+        /// Guards the backlog.
+        mutable std::mutex m_event_mutex;
+        std::condition_variable m_event_condition;
+        /// The latest events, in order of sequence.
+        std::deque<std::shared_ptr<event const>> m_events;
+        /// The sequence number of the latest event.
+        uint64_t m_sequence;
+
+    public:
+        live_feed() noexcept;
+
+        ~live_feed();
+
+        live_feed(live_feed const&) = delete;
+        live_feed(live_feed&&)      = delete;
+
+        live_feed& operator = (live_feed const&) = delete;
+        live_feed& operator = (live_feed&&)      = delete;
+
+        /**
+         * @brief Start publishing captured values on a thread of its own, as soon as they are captured.
+         */
+        void start();
+
+        /**
+         * @brief Stop the publishing thread and wake every subscriber waiting for an event.
+         */
+        void stop();
+
+        /**
+         * @brief Whether the feed is being stopped. Subscribers should end their streams.
+         */
+        [[nodiscard]]
+        bool stopping() const noexcept {
+            return m_stopping.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Capture the attribute values of rendered channels.
+         *
+         * @param a_server   The server hosting the channels, which knows their numbers.
+         * @param a_channels The channels rendered, each once.
+         * @param a_frame    The index of the frame the channels were rendered for.
+         *
+         * @note Render thread only. Returns immediately while there are no subscribers.
+         */
+        void capture(server const& a_server, std::span<channel::channel* const> a_channels, uint64_t a_frame);
+
+        /**
+         * @brief Forget a deleted channel, telling subscribers it is gone with the next event.
+         *
+         * @param a_channel_number The number of the channel.
+         *
+         * @note Called by the server when a channel is deleted, while the render thread is not capturing.
+         */
+        void remove_channel(size_t a_channel_number);
+
+        /**
+         * @brief Serialize the values captured since the last publish into one event and hand it to every subscriber.
+         *
+         * @return True if an event was published or false if no value changed.
+         *
+         * @note Called by the publishing thread once started. Must not be called concurrently with itself.
+         */
+        bool publish();
+
+        /**
+         * @brief Register a subscriber, so values are captured.
+         *
+         * @param a_max_subscribers The most subscribers allowed at once.
+         *
+         * @return True if the subscriber was registered or false if there are already as many as allowed.
+         */
+        bool subscribe(size_t a_max_subscribers = static_cast<size_t>(-1)) noexcept;
+
+        /**
+         * @brief Unregister a subscriber.
+         */
+        void unsubscribe() noexcept {
+            m_subscribers.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Get the amount of subscribers.
+         */
+        [[nodiscard]]
+        size_t subscribers() const noexcept {
+            return m_subscribers.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Get the sequence number of the latest event.
+         */
+        [[nodiscard]]
+        uint64_t sequence() const noexcept;
+
+        /**
+         * @brief Get the event a subscriber should be sent next, waiting for it to be published if needed.
+         *
+         * @param a_last_sequence The sequence number of the last event the subscriber received, or an empty optional
+         *                        for a new subscriber.
+         * @param a_timeout       The longest to wait for an event.
+         *
+         * @return The event following the last one received, a resync event if the subscriber is new or the event
+         *         is no longer in the backlog, or nullptr if no event was published within the timeout or the feed is
+         *         stopping.
+         */
+        [[nodiscard]]
+        std::shared_ptr<event const> next_event(std::optional<uint64_t> a_last_sequence, std::chrono::milliseconds a_timeout);
+
+    private:
+        /// Serialize a resync event at a sequence number.
+        [[nodiscard]]
+        static std::shared_ptr<event const> resync_event(uint64_t a_sequence);
+    };
+
+}
+
+#endif //MASTER_SERVER_LIVE_FEED_HPP
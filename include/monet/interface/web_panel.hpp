@@ -15,6 +15,7 @@
 #include <json.hpp>
 
 #include "../definitions.hpp"
+#include "live_feed.hpp"
 
 namespace monet::interface {
 
@@ -33,6 +34,8 @@ namespace monet::interface {
         std::unique_ptr<httplib::SSLServer> m_server;
 
         uint16_t m_port;
+        /// Amount of threads requests are served on.
+        size_t m_thread_count;
 
         std::string m_certificate_file;
         std::string m_private_key_file;
@@ -40,14 +43,19 @@ namespace monet::interface {
         std::unordered_map<std::string, handler> m_api_get_handlers;
         std::unordered_map<std::string, handler> m_api_post_handlers;
 
+        /// Changes pushed to the subscribers of /api/live.
+        live_feed m_feed;
+
     public:
         explicit web_panel(server& a_host) :
             m_host(a_host),
             m_main_thread(),
             m_server(nullptr),
             m_port(default_web_panel_port),
+            m_thread_count(default_web_panel_threads),
             m_certificate_file(),
-            m_private_key_file()
+            m_private_key_file(),
+            m_feed()
         {}
 
         web_panel(web_panel const&) = delete;
@@ -115,6 +123,50 @@ namespace monet::interface {
             return m_port;
         }
 
+        /**
+         * @brief Set the amount of threads requests are served on.
+         *
+         * @note Every subscriber of the live feed holds a thread while connected. Takes effect on start().
+         */
+        void set_thread_count(size_t const a_thread_count) noexcept {
+            m_thread_count = a_thread_count;
+        }
+
+        /**
+         * @brief Get the amount of threads requests are served on.
+         */
+        [[nodiscard]]
+        size_t thread_count() const noexcept {
+            return m_thread_count;
+        }
+
+        /**
+         * @brief Get the most subscribers the live feed is served to at once.
+         *
+         * @return The thread count, less the threads kept free for API requests: web_panel_reserved_threads, or half
+         *         the threads if there are fewer than twice as many.
+         */
+        [[nodiscard]]
+        size_t max_live_subscribers() const noexcept {
+            return m_thread_count - std::min(web_panel_reserved_threads, m_thread_count / 2);
+        }
+
+        /**
+         * @brief Get the live feed pushing changed channels to the subscribers of /api/live.
+         */
+        [[nodiscard]]
+        live_feed& feed() noexcept {
+            return m_feed;
+        }
+
+        /**
+         * @brief Get the live feed pushing changed channels to the subscribers of /api/live.
+         */
+        [[nodiscard]]
+        live_feed const& feed() const noexcept {
+            return m_feed;
+        }
+
         /**
          * @brief Test a request's Authorization header.
          *
@@ -0,0 +1,146 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_RECORDING_HPP
+#define MASTER_SERVER_RECORDING_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+#include "definitions.hpp"
+
+namespace monet::recording {
+
+    /// Identifies a recording file.
+    constexpr std::array<char, 8> file_magic{ 'M', 'O', 'N', 'E', 'T', 'R', 'E', 'C' };
+    constexpr uint32_t file_version = 1;
+
+    /**
+     * @brief The header at the start of a recording file.
+     */
+    struct file_header {
+        std::array<char, 8> magic;
+        uint32_t version;
+        /// Size of a record, so readers can reject files written with another layout.
+        uint32_t record_size;
+        /// When the recording started, in nanoseconds since the UNIX epoch.
+        int64_t start_time;
+        /// Interval between index entries, in nanoseconds.
+        int64_t index_interval;
+        /// Amount of records written. Updated after every frame, so a recording cut short stays readable.
+        uint64_t record_count;
+        /// Amount of frames written.
+        uint64_t frame_count;
+        std::array<uint8_t, 16> reserved;
+    };
+
+    static_assert(sizeof(file_header) == 64);
+
+    /**
+     * @brief One universe as output in one frame, or an index entry.
+     *
+     * An index entry starts a frame in which every universe is recorded, so the state of every universe at any point
+     * can be rebuilt from the last index entry before it. Other frames only record the universes that changed.
+     */
+    struct record {
+        /// Time since the recording started, in nanoseconds.
+        uint64_t time;
+        /// Index of the frame within the recording.
+        uint32_t frame;
+        /// The universe number, or 0 for an index entry.
+        uint16_t universe_number;
+        /// Amount of addresses in use, including the start code. For an index entry, the amount of universe records
+        /// that follow it in the same frame.
+        uint16_t address_count;
+        /// The start code followed by the address data.
+        std::array<uint8_t, universe_buffer_size> data;
+        std::array<uint8_t, 15> reserved;
+
+        /// Check whether the record is an index entry.
+        [[nodiscard]]
+        bool index() const noexcept {
+            return universe_number == 0;
+        }
+    };
+
+    static_assert(sizeof(record) == 544);
+
+    /**
+     * @brief A read-only, memory-mapped view of a recording file.
+     */
+    class reader {
+        int m_file;
+        void* m_mapping;
+        size_t m_size;
+
+    public:
+        reader() noexcept;
+
+        ~reader();
+
+        reader(reader const&) = delete;
+        reader(reader&&)      = delete;
+
+        reader& operator = (reader const&) = delete;
+        reader& operator = (reader&&)      = delete;
+
+        /**
+         * @brief Map a recording file.
+         *
+         * @param a_file The file path.
+         *
+         * @return True if the file was mapped and is a recording with the record layout of this build.
+         */
+        bool open(std::filesystem::path const& a_file);
+
+        /**
+         * @brief Unmap the file.
+         */
+        void close() noexcept;
+
+        /**
+         * @brief Check whether a file is mapped.
+         */
+        [[nodiscard]]
+        bool is_open() const noexcept {
+            return m_mapping != nullptr;
+        }
+
+        /**
+         * @brief Get the file header.
+         *
+         * @return The header. Only valid while a file is mapped.
+         */
+        [[nodiscard]]
+        file_header const& header() const noexcept {
+            return *static_cast<file_header const*>(m_mapping);
+        }
+
+        /**
+         * @brief Get every record written, in the order written.
+         *
+         * @return The records, read in place from the mapping.
+         */
+        [[nodiscard]]
+        std::span<record const> records() const noexcept;
+
+        /**
+         * @brief Find where to start reading to rebuild the state of every universe at a point in time.
+         *
+         * @param a_time Time since the recording started.
+         *
+         * @return The index of the last index entry at or before the time, or the amount of records if there is none.
+         *
+         * Binary searches the records by time, then steps back to the index entry.
+         */
+        [[nodiscard]]
+        size_t seek(std::chrono::nanoseconds a_time) const noexcept;
+    };
+
+}
+
+#endif //MASTER_SERVER_RECORDING_HPP
@@ -6,39 +6,115 @@
 #define MASTER_SERVER_SERVER_HPP
 
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <optional>
 #include <thread>
 
+#include "address/merge_engine.hpp"
+#include "address/output_stage.hpp"
+#include "address/universe_table.hpp"
 #include "interface/web_panel.hpp"
 #include "sink/sink.hpp"
+#include "command.hpp"
+#include "command_queue.hpp"
+#include "cue_stack.hpp"
+#include "effect_engine.hpp"
+#include "fade_engine.hpp"
+#include "frame_exchange.hpp"
+#include "frame_scheduler.hpp"
+#include "frame_snapshot.hpp"
+#include "sink_output.hpp"
+#include "worker_pool.hpp"
 
 namespace monet {
 
     class server {
         std::atomic_bool m_running;
+        /// Render thread.
         std::thread m_main_thread;
-
-        std::unordered_map<size_t, std::unique_ptr<address::universe>> m_universes;
-        std::unique_ptr<sink::sink> m_sink;
-        size_t m_sink_framerate;
-        size_t m_sink_frame_time;
-        std::chrono::high_resolution_clock::time_point m_last_frame_time;
+        /// Guards the channels, configurations, and sinks. Held by the render thread for the whole of each frame.
+        mutable std::mutex m_mutex;
+
+        address::universe_table m_universes;
+        /// Merges overrides and external input with the rendered universes before output.
+        address::merge_engine m_merge;
+        /// Applies curves, limits, and the grand master to the merged universes before output.
+        address::output_stage m_output_stage;
+        /// Whether the output stage has to be rebuilt from the patch before the next frame.
+        bool m_output_stage_stale;
+        /// Sum of the configuration revisions the output stage was built from.
+        size_t m_output_stage_revision;
+        /// Paces the render stage.
+        frame_scheduler m_frame_scheduler;
+
+        /// Rendered frames passed from the render stage to every sink output.
+        frame_exchange<frame_snapshot> m_frames;
+        /// Sinks, each output on a thread of its own. Declared after m_frames so their threads stop first.
+        std::vector<std::unique_ptr<sink_output>> m_sink_outputs;
+        /// Index of the next frame to be rendered.
+        uint64_t m_frame_index;
+        /// Amount of rendered frames dropped because no snapshot slot was free.
+        std::atomic<size_t> m_dropped_frames;
+        /// Time the last frame took to render, in nanoseconds.
+        std::atomic<int64_t> m_render_time;
+        /// Time the effects of the last frame took to evaluate, in nanoseconds.
+        std::atomic<int64_t> m_effect_time;
+
+        /// Mutations queued by control surfaces, applied by the render thread.
+        command_queue<command, command_queue_capacity> m_commands;
+
+        /// Active fades, advanced by the render thread every frame.
+        fade_engine m_fades;
+        /// Running effects, evaluated by the render thread every frame after the fades.
+        effect_engine m_effects;
+        /// Cue stacks, played back by the render thread through the command queue.
+        std::vector<std::unique_ptr<cue_stack>> m_cue_stacks;
+
+        /// Threads channel rendering is spread over.
+        worker_pool m_render_pool;
+        /// Channels to be rendered this frame, possibly with duplicates.
+        std::vector<channel::channel*> m_render_queue;
+        /// Channels to be rendered this frame, grouped by universe table slot.
+        std::vector<std::vector<channel::channel*>> m_render_groups;
+        /// Universe table slots with channels to be rendered this frame.
+        std::vector<size_t> m_render_group_slots;
 
         interface::web_panel m_web_panel_interface;
 
         std::map<std::string_view, std::unique_ptr<channel::configuration>> m_configurations;
+        /// Values of the attributes of every channel. Declared before m_channels so it outlives them.
+        channel::attribute::attribute_store m_attribute_store;
         std::unordered_map<size_t, std::unique_ptr<channel::channel>> m_channels;
+        /// The number of every channel, for reporting rendered channels by number. Like m_channels, only modified with
+        /// m_mutex held, so the render thread can read it during a frame.
+        std::unordered_map<channel::channel const*, size_t> m_channel_numbers;
 
     public:
         server() :
                 m_running(false),
                 m_main_thread(),
+                m_mutex(),
                 m_universes(),
-                m_sink(nullptr),
-                m_sink_framerate(default_sink_framerate),
-                m_sink_frame_time(std::nano::den / default_sink_framerate),
-                m_last_frame_time(std::chrono::high_resolution_clock::now()),
+                m_merge(),
+                m_output_stage(),
+                m_output_stage_stale(false),
+                m_output_stage_revision(0),
+                m_frame_scheduler(default_sink_framerate),
+                m_frames(),
+                m_sink_outputs(),
+                m_frame_index(0),
+                m_dropped_frames(0),
+                m_render_time(0),
+                m_effect_time(0),
+                m_commands(),
+                m_fades(),
+                m_effects(),
+                m_cue_stacks(),
+                m_render_pool(default_render_threads),
+                m_render_queue(),
+                m_render_groups(),
+                m_render_group_slots(),
                 m_web_panel_interface(*this)
         {}
 
@@ -51,25 +127,193 @@ namespace monet {
         /**
          * @brief Start the server.
          *
-         * Start the server by creating a new thread and looping poll().
+         * Start the server by creating a render thread, which calls render_frame() once per frame, and starting every
+         * sink output, each of which outputs the newest rendered frame on its own thread half a frame later. Every
+         * thread sleeps between frames according to its own framerate.
          */
         void start();
 
         /**
          * @brief Stop the server.
          *
-         * Stop the running server and join the thread.
+         * Stop the running server and join the threads.
          */
         void stop();
 
         /**
-         * @brief Tick/update the server. Should be called constantly.
+         * @brief Tick/update the server on the calling thread.
          *
-         * Update DMX devices, progress animations/fades, handle web control panel requests, and perform
-         * other miscellaneous tasks.
+         * Runs render_frame() followed immediately by output_frame(). For driving the server manually instead of
+         * through start().
          */
         void poll();
 
+        /**
+         * @brief Run the render stage for one frame.
+         *
+         * Apply queued commands, progress animations/fades, and perform other miscellaneous tasks, then merge the
+         * rendered universes with the merge sources, transform them through the output stage, and publish a snapshot of
+         * every universe to the sink outputs. Only the universes that changed since the snapshot slot was last used are
+         * copied. Sink outputs that are still sending an older snapshot only skip frames; they never hold up rendering.
+         *
+         * Holds the lock taken by lock_channels() for the whole frame.
+         */
+        void render_frame();
+
+        /**
+         * @brief Queue a mutation to be applied by the render thread at the start of the next frame.
+         *
+         * @param a_command The mutation.
+         *
+         * @return True if the command was queued or false if the queue is full.
+         *
+         * Safe to call from any thread. Control surfaces, such as the web panel, should use this instead of modifying
+         * channels or universes directly.
+         */
+        bool enqueue_command(command a_command) noexcept {
+            return m_commands.enqueue(std::move(a_command));
+        }
+
+        /**
+         * @brief Lock the channels, configurations, and sinks against the render thread.
+         *
+         * @return The lock. Hold it while reading channels from any thread other than the render thread, such as a
+         *         control surface reporting their values, and release it quickly: rendering waits for it.
+         *
+         * @note Creating or deleting channels, creating configurations, and changing sinks take the lock themselves.
+         */
+        [[nodiscard]]
+        std::unique_lock<std::mutex> lock_channels() const {
+            return std::unique_lock(m_mutex);
+        }
+
+        /**
+         * @brief Run the output stage for one frame on the calling thread.
+         *
+         * Every sink output takes the newest snapshot published by the render stage, skipping any older ones, and
+         * hands the universes that are due and routed to its sink. See sink_output::output_frame().
+         */
+        void output_frame();
+
+        /**
+         * @brief Queue a channel to be rendered into its universe by render_channels().
+         *
+         * @param a_channel The channel. Queueing the same channel more than once per frame is harmless.
+         *
+         * @note Render thread only.
+         */
+        void mark_for_render(channel::channel& a_channel) {
+            m_render_queue.push_back(&a_channel);
+        }
+
+        /**
+         * @brief Render every channel queued with mark_for_render() into its universe.
+         *
+         * Channels are grouped by the universe they output to and the groups are spread over the render threads, so
+         * no two threads ever write to the same universe. Called by render_frame().
+         */
+        void render_channels();
+
+        /**
+         * @brief Render every channel into its universe.
+         */
+        void render_all_channels();
+
+        /**
+         * @brief Get the fade engine.
+         *
+         * @return The fade engine.
+         *
+         * @note Render thread only while the server is running. Control surfaces fade through enqueue_command().
+         */
+        [[nodiscard]]
+        fade_engine& fades() noexcept {
+            return m_fades;
+        }
+
+        /**
+         * @brief Get the effect engine.
+         *
+         * @return The effect engine.
+         *
+         * @note Render thread only while the server is running. Large effects are spread over the render threads.
+         */
+        [[nodiscard]]
+        effect_engine& effects() noexcept {
+            return m_effects;
+        }
+
+        /**
+         * @brief Create a cue stack.
+         *
+         * @param a_name The name of the cue stack.
+         *
+         * @return The cue stack. Its index in cue_stacks() is the target of go_cue and go_to_cue commands.
+         *
+         * @note Must not be called while the server is running.
+         */
+        cue_stack& create_cue_stack(std::string a_name = {}) {
+            return *m_cue_stacks.emplace_back(std::make_unique<cue_stack>(std::move(a_name)));
+        }
+
+        /**
+         * @brief Get the cue stacks.
+         *
+         * @return The cue stacks.
+         *
+         * @note Render thread only while the server is running. Control surfaces GO through enqueue_command().
+         */
+        [[nodiscard]]
+        std::span<std::unique_ptr<cue_stack> const> cue_stacks() const noexcept {
+            return m_cue_stacks;
+        }
+
+        /**
+         * @brief Get the amount of threads channel rendering is spread over.
+         *
+         * @return The amount of render threads, including the render thread itself.
+         */
+        [[nodiscard]]
+        size_t render_threads() const noexcept {
+            return m_render_pool.thread_count();
+        }
+
+        /**
+         * @brief Set the amount of threads channel rendering is spread over.
+         *
+         * @param a_thread_count The new amount of render threads, including the render thread itself.
+         *
+         * @note Must not be called while the server is running.
+         */
+        void set_render_threads(size_t const a_thread_count) {
+            m_render_pool.set_thread_count(a_thread_count);
+        }
+
+    private:
+        /**
+         * @brief Apply every queued command.
+         *
+         * Commands are applied in the order they were queued. Each channel modified is queued for rendering.
+         */
+        void apply_commands();
+
+        /**
+         * @brief Add a sink output and resize the snapshot slots for it. Must be called with the lock held and the
+         *        sink outputs stopped.
+         */
+        sink_output& add_sink_output(sink::sink* a_sink, size_t a_framerate);
+
+        /**
+         * @brief Stop every sink output, if the server is running, so the snapshot slots can be resized.
+         */
+        void stop_sink_outputs();
+
+        /**
+         * @brief Start every sink output again, if the server is running.
+         */
+        void start_sink_outputs();
+
+    public:
         /**
          * @brief Create, allocate, and return a new universe.
          *
@@ -77,7 +321,10 @@ namespace monet {
          *
          * @return A reference to the created universe.
          *
-         * Create, allocate, and return a new universe with the specified universe number.
+         * Create, allocate, and return a new universe with the specified universe number. If the universe already
+         * exists, it is returned instead.
+         *
+         * @note Throws std::out_of_range if the universe number is outside of 1-63999.
          */
         address::universe& create_universe(size_t a_universe);
 
@@ -110,10 +357,69 @@ namespace monet {
          * @return           A reference to the universe with the specified number.
          *
          * Retrieve the universe with the specified number or create one if it does not exist.
+         *
+         * @note Throws std::out_of_range if the universe number is outside of 1-63999.
          */
         [[nodiscard]]
         address::universe& get_universe(size_t a_universe);
 
+        /**
+         * @brief Get all universes.
+         *
+         * @return The universe table.
+         */
+        [[nodiscard]]
+        address::universe_table& universes() noexcept {
+            return m_universes;
+        }
+
+        /**
+         * @brief Get all universes.
+         *
+         * @return The universe table.
+         */
+        [[nodiscard]]
+        address::universe_table const& universes() const noexcept {
+            return m_universes;
+        }
+
+        /**
+         * @brief Get the merge engine.
+         *
+         * @return The merge engine. Create a source on it for every writer that should be merged with the rendered
+         *         universes instead of overwriting them, such as manual overrides or external input.
+         *
+         * @note Only universes in the universe table are output. Sources must not be created or destroyed, nor modes
+         *       set, while the server is running, but sources can be written from any thread.
+         */
+        [[nodiscard]]
+        address::merge_engine& merge() noexcept {
+            return m_merge;
+        }
+
+        /**
+         * @brief Get the output stage.
+         *
+         * @return The output stage, built from the "curve", "gamma", "master", "min", "max", and "invert" properties
+         *         of the attribute definitions of every patched channel.
+         *
+         * @note Render thread only while the server is running. Control surfaces set the grand master through
+         *       enqueue_command().
+         */
+        [[nodiscard]]
+        address::output_stage& output_stage() noexcept {
+            return m_output_stage;
+        }
+
+        /**
+         * @brief Rebuild the output stage from the attribute definitions and addresses of every channel.
+         *
+         * Intensity addresses are mastered unless their "master" property says otherwise; fine addresses are output
+         * untransformed. Called by render_frame() when channels have been created or deleted or a configuration has
+         * been modified. Call it after repatching a channel.
+         */
+        void rebuild_output_stage();
+
         /**
          * @brief Set the value of an address.
          *
@@ -181,60 +487,138 @@ namespace monet {
         }
 
         /**
-         * @brief Get the current sink interface.
+         * @brief Get the first sink interface.
          *
-         * @return A pointer to the sink interface.
+         * @return A pointer to the first sink interface or nullptr if there are no sinks.
          */
         [[nodiscard]]
         sink::sink* sink_interface() noexcept {
-            return m_sink.get();
+            return m_sink_outputs.empty() ? nullptr : &m_sink_outputs.front()->sink_interface();
         }
 
         /**
-         * @brief Get the current sink interface.
+         * @brief Get the first sink interface.
          *
-         * @return A pointer to the sink interface.
+         * @return A pointer to the first sink interface or nullptr if there are no sinks.
          */
         [[nodiscard]]
         sink::sink const* sink_interface() const noexcept {
-            return m_sink.get();
+            return m_sink_outputs.empty() ? nullptr : &std::as_const(*m_sink_outputs.front()).sink_interface();
         }
 
         /**
-         * @brief Set the sink interface.
+         * @brief Replace every sink with a single sink interface.
          *
          * @param a_sink The sink interface.
          *
-         * @note The current sink's lifetime is managed by the server. There is no need to
-         * explicitly delete or otherwise explicitly manage its lifetime. Do not delete it
-         * while it is in use by the server.
+         * @note The sink's lifetime is managed by the server. There is no need to explicitly delete or otherwise
+         * explicitly manage its lifetime. While the server is running, every sink output is stopped and restarted.
          */
-        void set_sink_interface(sink::sink* a_sink) noexcept {
-            if (m_running) {
-                a_sink->initialize(*this);
-            }
+        void set_sink_interface(sink::sink* a_sink);
 
-            m_sink = std::unique_ptr<sink::sink>(a_sink);
+        /**
+         * @brief Add a sink, output alongside every other sink on a thread of its own.
+         *
+         * @param a_sink      The sink. Its lifetime is managed by the server.
+         * @param a_framerate The framerate the sink is output at, or 0 for the sink framerate.
+         *
+         * @return The sink output, through which the sink's routes are set and its latency and skipped frames read.
+         *
+         * @note While the server is running, every sink output is stopped and restarted, as the snapshot slots are
+         *       resized.
+         */
+        sink_output& add_sink(sink::sink* a_sink, size_t a_framerate = 0);
+
+        /**
+         * @brief Remove a sink, destroying it.
+         *
+         * @param a_sink The sink.
+         *
+         * @return True if the sink was removed or false if it is not output by the server.
+         *
+         * @note Safe to call while the server is running.
+         */
+        bool remove_sink(sink::sink const* a_sink);
+
+        /**
+         * @brief Get every sink output.
+         *
+         * @return The sink outputs, in the order the sinks were added.
+         */
+        [[nodiscard]]
+        std::span<std::unique_ptr<sink_output> const> sink_outputs() const noexcept {
+            return m_sink_outputs;
         }
 
         /**
          * @brief Get the framerate of the sink updating.
          *
-         * @return The sink framerate.
+         * @return The sink framerate, which frames are rendered at.
          */
         [[nodiscard]]
         size_t sink_framerate() const noexcept {
-            return m_sink_framerate;
+            return m_frame_scheduler.framerate();
         }
 
         /**
          * @brief Set the framerate of the sink updating.
          *
          * @param a_framerate The new sink framerate.
+         *
+         * Sets the framerate frames are rendered at and every sink is output at. Sinks that should output at a
+         * framerate of their own are set through sink_output::scheduler() afterwards.
+         */
+        void set_sink_framerate(size_t a_framerate) noexcept;
+
+        /**
+         * @brief Get the scheduler pacing the main thread.
+         *
+         * @return A reference to the frame scheduler.
+         */
+        [[nodiscard]]
+        frame_scheduler const& scheduler() const noexcept {
+            return m_frame_scheduler;
+        }
+
+        /**
+         * @brief Get the amount of frames missed since the server was started.
+         *
+         * @return The amount of frame deadlines that passed without a frame being rendered.
          */
-        void set_sink_framerate(size_t const a_framerate) noexcept {
-            m_sink_frame_time = std::nano::den / a_framerate;
-            m_sink_framerate = a_framerate;
+        [[nodiscard]]
+        size_t missed_frames() const noexcept {
+            return m_frame_scheduler.missed_frames();
+        }
+
+        /**
+         * @brief Get the amount of rendered frames dropped because no snapshot slot was free.
+         *
+         * @return The amount of dropped frames. Sinks that fall behind skip frames instead; see
+         *         sink_output::skipped_frames().
+         */
+        [[nodiscard]]
+        size_t dropped_frames() const noexcept {
+            return m_dropped_frames.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Get the time the last frame took to render, from applying commands to rendering channels.
+         *
+         * @return The render time of the last frame.
+         */
+        [[nodiscard]]
+        std::chrono::nanoseconds render_time() const noexcept {
+            return std::chrono::nanoseconds(m_render_time.load(std::memory_order_relaxed));
+        }
+
+        /**
+         * @brief Get the time the effects of the last frame took to evaluate.
+         *
+         * @return The effect time of the last frame. The cost of each effect is available through effect::cost().
+         */
+        [[nodiscard]]
+        std::chrono::nanoseconds effect_time() const noexcept {
+            return std::chrono::nanoseconds(m_effect_time.load(std::memory_order_relaxed));
         }
 
         /**
@@ -295,6 +679,19 @@ namespace monet {
         [[nodiscard]]
         channel::channel const* channel_by_number(size_t a_id) const noexcept;
 
+        /**
+         * @brief Get the ID of a channel.
+         *
+         * @param a_channel The channel.
+         *
+         * @return The ID the channel was created with or an empty optional if the channel was not created by the
+         *         server.
+         *
+         * @note Render thread only while the server is running, unless lock_channels() is held.
+         */
+        [[nodiscard]]
+        std::optional<size_t> channel_number(channel::channel const& a_channel) const noexcept;
+
         /**
          * @brief Create a new channel with the given ID and configuration.
          *
@@ -304,21 +701,37 @@ namespace monet {
          *
          * @return The newly created channel.
          *
-         * @note If a channel with the supplied ID already exists, it will be overwritten.
+         * @note If a channel with the supplied ID already exists, it will be overwritten. Safe to call from any thread.
          */
         channel::channel& create_channel(size_t a_id, std::string_view a_configuration, size_t a_base_address = 0);
 
+        /**
+         * @brief Create a new channel with the given ID and configuration.
+         *
+         * @param a_id            The ID of the new channel.
+         * @param a_configuration The configuration with which to create the new channel.
+         * @param a_base_address  The base address to which the address values of the channel will be mapped.
+         *
+         * @return The newly created channel.
+         *
+         * @note If a channel with the supplied ID already exists, it will be overwritten. The configuration must
+         * outlive the channel. Safe to call from any thread.
+         */
+        channel::channel& create_channel(size_t a_id, channel::configuration& a_configuration, size_t a_base_address = 0);
+
         /**
          * @brief Delete a channel by its ID.
          *
          * @param a_id The ID of the channel to delete.
+         *
+         * @note Safe to call from any thread.
          */
         void delete_channel(size_t a_id) noexcept;
 
         /**
          * @brief Get a list of channels.
          *
-         * @return The list of channels.
+         * @return The list of channels. Hold lock_channels() while iterating it from outside the render thread.
          */
         auto& channels() noexcept {
             return m_channels;
@@ -327,11 +740,29 @@ namespace monet {
         /**
          * @brief Get a list of channels.
          *
-         * @return The list of channels.
+         * @return The list of channels. Hold lock_channels() while iterating it from outside the render thread.
          */
         auto const& channels() const noexcept {
             return m_channels;
         }
+
+        /**
+         * @brief Get the store holding the attribute values of every channel.
+         *
+         * @return The attribute store, one dense attribute pool per attribute type.
+         */
+        channel::attribute::attribute_store& attribute_store() noexcept {
+            return m_attribute_store;
+        }
+
+        /**
+         * @brief Get the store holding the attribute values of every channel.
+         *
+         * @return The attribute store, one dense attribute pool per attribute type.
+         */
+        channel::attribute::attribute_store const& attribute_store() const noexcept {
+            return m_attribute_store;
+        }
     };
 
 }
@@ -0,0 +1,261 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_SHARED_UNIVERSES_HPP
+#define MASTER_SERVER_SHARED_UNIVERSES_HPP
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "definitions.hpp"
+
+/**
+ * The layout of the shared memory segment sink::shared_memory exports universes to, and a reader for it.
+ *
+ * This header only depends on the standard library, POSIX and definitions.hpp, so other programs on the same machine
+ * can include it on its own to read live universe data.
+ */
+namespace monet::shared_universes {
+
+    /// Identifies a universe segment.
+    constexpr std::array<char, 8> segment_magic{ 'M', 'O', 'N', 'E', 'T', 'S', 'H', 'M' };
+    constexpr uint32_t segment_version = 1;
+
+    /**
+     * @brief The header at the start of the segment.
+     */
+    struct alignas(cache_line_size) segment_header {
+        /// Stored last by the writer with release semantics and loaded first by readers with acquire semantics.
+        alignas(std::atomic_ref<std::array<char, 8>>::required_alignment) std::array<char, 8> magic;
+        uint32_t version;
+        /// Size of each universe in the segment.
+        uint32_t universe_size;
+        /// Amount of universes in the segment, indexed by universe number.
+        uint32_t universe_count;
+        uint32_t reserved;
+        /// Amount of frames published. Incremented once every universe of a frame has been written.
+        std::atomic<uint64_t> frame;
+        /// Process ID of the writer.
+        int64_t writer;
+    };
+
+    /**
+     * @brief A universe in the segment, guarded by a sequence lock.
+     *
+     * The sequence is odd while the writer is writing the universe, and advanced by two for every write, so readers
+     * can copy the universe without locks and retry if the sequence changed while they copied it. A sequence of 0
+     * means the universe has never been written.
+     */
+    struct alignas(cache_line_size) shared_universe {
+        std::atomic<uint64_t> sequence;
+        /// The frame the universe was last written in.
+        uint64_t frame;
+        /// Amount of addresses in use, including the start code.
+        uint16_t address_count;
+        std::array<uint8_t, universe_buffer_size> data;
+    };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared universes need address-free atomics");
+    static_assert(std::atomic_ref<std::array<char, 8>>::is_always_lock_free, "Shared universes need address-free atomics");
+
+    /// Size of a segment holding every universe number.
+    constexpr size_t segment_size = sizeof(segment_header) + (max_universe_number + 1) * sizeof(shared_universe);
+
+    /**
+     * @brief A consistent copy of a universe.
+     */
+    struct universe_snapshot {
+        /// The frame the universe was last written in.
+        uint64_t frame;
+        /// Amount of addresses in use, including the start code.
+        uint16_t address_count;
+        std::array<uint8_t, universe_buffer_size> data;
+    };
+
+    /**
+     * @brief Maps a universe segment read-only and takes consistent snapshots of its universes.
+     *
+     * Once the segment is open, reading involves no syscalls and never blocks the writer.
+     */
+    class reader {
+        int m_file;
+        void* m_mapping;
+
+    public:
+        reader() noexcept :
+            m_file(-1),
+            m_mapping(nullptr)
+        {}
+
+        ~reader() {
+            close();
+        }
+
+        reader(reader const&) = delete;
+        reader(reader&&)      = delete;
+
+        reader& operator = (reader const&) = delete;
+        reader& operator = (reader&&)      = delete;
+
+        /**
+         * @brief Map a universe segment.
+         *
+         * @param a_name The name of the segment.
+         *
+         * @return True if the segment exists and has been set up by a writer of this version.
+         */
+        bool open(char const* const a_name = default_shared_universes_name) {
+            close();
+
+            if ((m_file = shm_open(a_name, O_RDONLY, 0)) < 0) {
+                return false;
+            }
+
+            struct stat segment_status{};
+
+            if (fstat(m_file, &segment_status) < 0 || static_cast<size_t>(segment_status.st_size) < segment_size) {
+                close();
+                return false;
+            }
+
+            m_mapping = mmap(nullptr, segment_size, PROT_READ, MAP_SHARED, m_file, 0);
+
+            if (m_mapping == MAP_FAILED) {
+                m_mapping = nullptr;
+                close();
+                return false;
+            }
+
+            auto const& segment = header();
+
+            // The writer sets the magic last, so the rest of the header is only read once the magic matches. The
+            // load is lock-free, so it does not write to the read-only mapping.
+            auto& magic = const_cast<std::array<char, 8>&>(segment.magic);
+
+            if (std::atomic_ref(magic).load(std::memory_order_acquire) != segment_magic) {
+                close();
+                return false;
+            }
+
+            if (segment.version != segment_version ||
+                segment.universe_size != sizeof(shared_universe) || segment.universe_count != max_universe_number + 1) {
+                close();
+                return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Unmap the segment.
+         */
+        void close() noexcept {
+            if (m_mapping) {
+                munmap(m_mapping, segment_size);
+                m_mapping = nullptr;
+            }
+
+            if (m_file >= 0) {
+                ::close(m_file);
+                m_file = -1;
+            }
+        }
+
+        [[nodiscard]]
+        bool is_open() const noexcept {
+            return m_mapping != nullptr;
+        }
+
+        /**
+         * @brief Get the segment header.
+         *
+         * @note Only valid while the segment is open.
+         */
+        [[nodiscard]]
+        segment_header const& header() const noexcept {
+            return *static_cast<segment_header const*>(m_mapping);
+        }
+
+        /**
+         * @brief Get the amount of frames the writer has published.
+         */
+        [[nodiscard]]
+        uint64_t frame() const noexcept {
+            return header().frame.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Get the sequence of a universe, to tell cheaply whether it changed since it was last read.
+         *
+         * @param a_universe The universe number.
+         *
+         * @return The sequence, or 0 if the universe has never been written or is not valid.
+         */
+        [[nodiscard]]
+        uint64_t sequence(size_t const a_universe) const noexcept {
+            if (a_universe < min_universe_number || a_universe > max_universe_number) {
+                return 0;
+            }
+
+            return universe_at(a_universe).sequence.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Take a consistent snapshot of a universe.
+         *
+         * @param a_universe The universe number.
+         * @param a_snapshot The snapshot to copy the universe into.
+         *
+         * @return True if the universe was copied, or false if it has never been written or is not valid.
+         */
+        bool read(size_t const a_universe, universe_snapshot& a_snapshot) const noexcept {
+            if (a_universe < min_universe_number || a_universe > max_universe_number) {
+                return false;
+            }
+
+            auto const& universe = universe_at(a_universe);
+
+            for (;;) {
+                auto const sequence = universe.sequence.load(std::memory_order_acquire);
+
+                if (sequence == 0) {
+                    return false;
+                }
+
+                // The writer is writing the universe; it only takes as long as one copy.
+                if (sequence & 1) {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                a_snapshot.frame = universe.frame;
+                a_snapshot.address_count = universe.address_count;
+                std::memcpy(a_snapshot.data.data(), universe.data.data(), universe_buffer_size);
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if (universe.sequence.load(std::memory_order_relaxed) == sequence) {
+                    return true;
+                }
+            }
+        }
+
+    private:
+        /// Get a universe in the segment.
+        [[nodiscard]]
+        shared_universe const& universe_at(size_t const a_universe) const noexcept {
+            return reinterpret_cast<shared_universe const*>(static_cast<uint8_t const*>(m_mapping) + sizeof(segment_header))[a_universe];
+        }
+    };
+
+}
+
+#endif //MASTER_SERVER_SHARED_UNIVERSES_HPP
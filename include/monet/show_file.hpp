@@ -0,0 +1,270 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_SHOW_FILE_HPP
+#define MASTER_SERVER_SHOW_FILE_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+#include "address/universe_table.hpp"
+#include "recording.hpp"
+
+namespace monet::recording {
+
+    /// Identifies a show file.
+    constexpr std::array<char, 8> show_file_magic{ 'M', 'O', 'N', 'E', 'T', 'S', 'H', 'W' };
+    constexpr uint32_t show_file_version = 1;
+
+    /**
+     * @brief The header at the start of a show file.
+     *
+     * A show file is a recording compacted for playback. Each frame only holds the universes that changed since the
+     * frame before it, and each universe only the address ranges that changed, as runs of one value or as literal
+     * values. Keyframes hold every universe in full, against an all-zero universe, so playback can start from any
+     * of them. The keyframe index at the end of the file is sorted by time for seeking.
+     */
+    struct show_file_header {
+        std::array<char, 8> magic;
+        uint32_t version;
+        uint32_t reserved0;
+        /// When the recording started, in nanoseconds since the UNIX epoch.
+        int64_t start_time;
+        /// Time of the last frame since the recording started, in nanoseconds.
+        uint64_t duration;
+        uint64_t frame_count;
+        uint64_t keyframe_count;
+        /// Offset of the keyframe index from the start of the file.
+        uint64_t keyframe_offset;
+        uint64_t reserved1;
+    };
+
+    static_assert(sizeof(show_file_header) == 64);
+
+    /**
+     * @brief An entry of the keyframe index.
+     */
+    struct show_keyframe {
+        /// Time since the recording started, in nanoseconds.
+        uint64_t time;
+        /// Index of the frame.
+        uint64_t frame;
+        /// Offset of the frame from the start of the file.
+        uint64_t offset;
+    };
+
+    /**
+     * @brief Precedes the universes of a frame.
+     */
+    struct show_frame_header {
+        /// Time since the recording started, in nanoseconds.
+        uint64_t time;
+        /// Size of the universes that follow, in bytes.
+        uint32_t size;
+        uint16_t universe_count;
+        /// Whether the frame is a keyframe.
+        uint16_t keyframe;
+    };
+
+    /**
+     * @brief Precedes the address ranges of a universe.
+     */
+    struct show_universe_header {
+        uint16_t universe_number;
+        /// Amount of addresses in use, including the start code.
+        uint16_t address_count;
+        /// Size of the ranges that follow, in bytes.
+        uint16_t size;
+        uint16_t reserved;
+    };
+
+    /**
+     * @brief An address range of a universe, followed by one value for a run or `count` values otherwise.
+     */
+    struct show_range {
+        /// Amount of unchanged addresses between the end of the previous range (or the start code) and this one.
+        uint16_t skip;
+        /// Amount of addresses in the range, with show_range::run set for a run of one value.
+        uint16_t count;
+
+        constexpr static uint16_t run = 0x8000;
+    };
+
+    static_assert(sizeof(show_frame_header) == 16 && sizeof(show_universe_header) == 8 && sizeof(show_range) == 4);
+
+    /**
+     * @brief Compact a recording into a show file.
+     *
+     * @param a_recording         The recording.
+     * @param a_file              The show file to write.
+     * @param a_keyframe_interval The interval between keyframes. Longer intervals compress better and seek slower.
+     *
+     * @return True if the show file was written.
+     */
+    bool encode_show_file(reader const& a_recording, std::filesystem::path const& a_file, std::chrono::nanoseconds a_keyframe_interval = show_keyframe_interval);
+
+    /**
+     * @brief Decodes a memory-mapped show file frame by frame into a universe table.
+     *
+     * Frames are decoded straight from the mapping into the universes, without intermediate buffers. Each decoded
+     * universe is marked dirty over the addresses the frame changed, so consumers can take only those and clear the
+     * dirty range after.
+     */
+    class show_player {
+        int m_file;
+        void* m_mapping;
+        size_t m_size;
+
+        address::universe_table m_universes;
+        /// Offset of the next frame to decode.
+        size_t m_offset;
+        /// Index of the next frame to decode.
+        uint64_t m_frame;
+        /// Time of the frame decoded last.
+        uint64_t m_time;
+        /// Universe numbers changed by the frame decoded last.
+        std::vector<size_t> m_changed;
+
+    public:
+        show_player() noexcept;
+
+        ~show_player();
+
+        show_player(show_player const&) = delete;
+        show_player(show_player&&)      = delete;
+
+        show_player& operator = (show_player const&) = delete;
+        show_player& operator = (show_player&&)      = delete;
+
+        /**
+         * @brief Map a show file and rewind to its start.
+         *
+         * @param a_file The file path.
+         *
+         * @return True if the file was mapped and is a show file of this version.
+         */
+        bool open(std::filesystem::path const& a_file);
+
+        /**
+         * @brief Unmap the file.
+         */
+        void close() noexcept;
+
+        [[nodiscard]]
+        bool is_open() const noexcept {
+            return m_mapping != nullptr;
+        }
+
+        /**
+         * @brief Get the file header.
+         *
+         * @return The header. Only valid while a file is mapped.
+         */
+        [[nodiscard]]
+        show_file_header const& header() const noexcept {
+            return *static_cast<show_file_header const*>(m_mapping);
+        }
+
+        /**
+         * @brief Get the keyframe index.
+         *
+         * @return The keyframes, sorted by time.
+         */
+        [[nodiscard]]
+        std::span<show_keyframe const> keyframes() const noexcept;
+
+        /**
+         * @brief Decode the next frame.
+         *
+         * @return True if a frame was decoded or false at the end of the file.
+         */
+        bool next_frame();
+
+        /**
+         * @brief Move to a point in time.
+         *
+         * @param a_time Time since the recording started.
+         *
+         * Binary searches the keyframe index for the last keyframe at or before the time, then decodes every frame up
+         * to the time. Every universe is marked changed.
+         */
+        void seek(std::chrono::nanoseconds a_time);
+
+        /**
+         * @brief Check whether every frame has been decoded.
+         */
+        [[nodiscard]]
+        bool finished() const noexcept {
+            return !m_mapping || m_frame >= header().frame_count;
+        }
+
+        /**
+         * @brief Get the time of the frame decoded last.
+         */
+        [[nodiscard]]
+        std::chrono::nanoseconds time() const noexcept {
+            return std::chrono::nanoseconds(m_time);
+        }
+
+        /**
+         * @brief Get the time of the next frame.
+         *
+         * @return The time of the next frame, or the time of the last frame once finished.
+         */
+        [[nodiscard]]
+        std::chrono::nanoseconds next_time() const noexcept;
+
+        /**
+         * @brief Get the index of the next frame to decode.
+         */
+        [[nodiscard]]
+        uint64_t frame() const noexcept {
+            return m_frame;
+        }
+
+        /**
+         * @brief Get the universe numbers changed by the frame decoded last.
+         */
+        [[nodiscard]]
+        std::span<size_t const> changed() const noexcept {
+            return m_changed;
+        }
+
+        /**
+         * @brief Get the decoded universes.
+         */
+        [[nodiscard]]
+        address::universe_table& universes() noexcept {
+            return m_universes;
+        }
+
+        /**
+         * @brief Get the decoded universes.
+         */
+        [[nodiscard]]
+        address::universe_table const& universes() const noexcept {
+            return m_universes;
+        }
+
+    private:
+        /// Get a pointer into the mapping.
+        [[nodiscard]]
+        uint8_t const* at(size_t const a_offset) const noexcept {
+            return static_cast<uint8_t const*>(m_mapping) + a_offset;
+        }
+
+        /// Decode the frame at an offset into the universes.
+        void decode_frame(size_t a_offset);
+
+        /// Move to the start of the file, zeroing every universe.
+        void rewind();
+    };
+
+}
+
+#endif //MASTER_SERVER_SHOW_FILE_HPP
@@ -0,0 +1,241 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_ARTNET_HPP
+#define MASTER_SERVER_ARTNET_HPP
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__)
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
+
+#include "sink.hpp"
+
+namespace monet::sink {
+
+    /**
+     * @brief Outputs universes as Art-Net (ArtDmx), followed by an ArtSync every frame.
+     *
+     * Universe n is sent to Art-Net port address n - 1. Each universe keeps an ArtDmx header that is built once, so a
+     * frame only patches the sequence number and length before all packets are handed to the kernel with a single
+     * sendmmsg() call. The data is gathered straight from the universe buffer instead of being copied into the packet,
+     * so a universe mirrored to several port addresses shares one payload. Packets are unicast to every node outputting
+     * their port address, found through ArtPoll discovery or added by hand, and broadcast if no node is known to output
+     * it. The ArtSync sent at the end of each frame makes nodes latch the whole frame at once.
+     */
+    class artnet : public sink {
+    public:
+        /// Size of an ArtDmx header, up to the data.
+        constexpr static size_t dmx_header_size = 18;
+
+        /**
+         * @brief A node receiving Art-Net.
+         */
+        struct node {
+            sockaddr_in address{};
+            /// The port addresses the node outputs.
+            std::vector<uint16_t> port_addresses;
+            /// When the node last answered an ArtPoll, for discovered nodes.
+            clock::time_point last_seen{};
+            /// Whether the node was added by hand and never expires.
+            bool manual = false;
+        };
+
+    private:
+        /// A universe's reusable ArtDmx header and its destinations.
+        struct universe_packet {
+            std::array<uint8_t, dmx_header_size> header{};
+            /// The data sent after the header in the current frame, and its length.
+            uint8_t const* data = nullptr;
+            size_t length = 0;
+            /// Indices into m_nodes of the nodes outputting the port address, or empty to broadcast.
+            std::vector<size_t> destinations;
+        };
+
+        int m_socket_id;
+        uint16_t m_port;
+        std::string m_broadcast_host;
+        sockaddr_in m_broadcast_address;
+        bool m_discovery;
+        bool m_sync;
+
+        std::vector<node> m_nodes;
+        /// Incremented whenever nodes are added, removed, or change ports, to refresh packet destinations.
+        size_t m_nodes_revision;
+        /// The node revision packet destinations were last resolved for.
+        size_t m_destinations_revision;
+        clock::time_point m_last_poll;
+
+        std::unordered_map<size_t, std::unique_ptr<universe_packet>> m_packets;
+        std::array<uint8_t, 14> m_sync_packet;
+        std::array<uint8_t, 14> m_poll_packet;
+        /// Receive buffer for ArtPollReply packets.
+        std::array<uint8_t, 512> m_reply_buffer;
+
+        /// Packets built for the frame being sent.
+        std::vector<universe_packet*> m_frame_packets;
+
+#if defined(__linux__)
+        /// Message headers and buffers for batched transmission, reused between frames. Two buffers per packet.
+        std::vector<mmsghdr> m_frame_messages;
+        std::vector<iovec> m_frame_buffers;
+#else
+        /// Header and data of a packet joined for sending.
+        std::array<uint8_t, dmx_header_size + dmx_data_channel_count> m_send_buffer;
+#endif
+
+        /// Packets that failed to send.
+        std::atomic<size_t> m_send_errors;
+
+    public:
+        /**
+         * @brief Create an Art-Net sink.
+         *
+         * @param a_broadcast_host The address packets for port addresses without a known node are broadcast to, or
+         *                         empty to drop them.
+         * @param a_port           The UDP port nodes listen on.
+         */
+        explicit artnet(std::string a_broadcast_host = "255.255.255.255", uint16_t a_port = default_artnet_port) noexcept;
+
+        /**
+         * @brief Initialize the adapter.
+         *
+         * @param a_server A reference to the host server instance.
+         *
+         * Discovery replies are only received if the Art-Net port can be bound on this machine.
+         */
+        bool initialize(server& a_server) override;
+
+        /**
+         * @brief Deinitialize the adapter.
+         */
+        void deinitialize() override;
+
+        /**
+         * @brief Output data to a specific universe, followed by an ArtSync.
+         *
+         * @param a_universe_number The universe number.
+         * @param a_universe        The universe.
+         */
+        void send_universe(size_t a_universe_number, address::universe const& a_universe) override;
+
+        /**
+         * @brief Output a set of universes for one frame.
+         *
+         * @param a_universes The universes to output.
+         *
+         * Patches every packet first, transmits them with a single sendmmsg() call where available, then sends the
+         * ArtSync. Discovery replies are collected and ArtPolls sent from here, on the output thread.
+         */
+        void send_frame(std::span<frame_universe const> a_universes) override;
+
+        /**
+         * @brief Add a node to unicast to.
+         *
+         * @param a_host           The IPv4 address of the node.
+         * @param a_port_addresses The port addresses the node outputs.
+         *
+         * @return True if the address is valid.
+         *
+         * @note Nodes are read on the output thread, so must not be added while the server is running.
+         */
+        bool add_node(std::string const& a_host, std::vector<uint16_t> a_port_addresses);
+
+        /**
+         * @brief Get the known nodes, added or discovered.
+         *
+         * @return The nodes.
+         */
+        [[nodiscard]]
+        std::span<node const> nodes() const noexcept {
+            return m_nodes;
+        }
+
+        /**
+         * @brief Enable or disable ArtPoll discovery.
+         *
+         * @param a_discovery Whether to poll for nodes.
+         */
+        void set_discovery(bool const a_discovery) noexcept {
+            m_discovery = a_discovery;
+        }
+
+        /**
+         * @brief Enable or disable ArtSync.
+         *
+         * @param a_sync Whether to send an ArtSync after every frame.
+         */
+        void set_sync(bool const a_sync) noexcept {
+            m_sync = a_sync;
+        }
+
+        /**
+         * @brief Get the amount of packets that failed to send.
+         *
+         * A packet failing to send is skipped; the rest of the frame is still sent.
+         *
+         * @return The send error count.
+         */
+        [[nodiscard]]
+        size_t send_errors() const noexcept {
+            return m_send_errors.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Get the port address a universe is output on.
+         *
+         * @param a_universe_number The universe number.
+         *
+         * @return The 15-bit Art-Net port address (net, sub-net, and universe).
+         */
+        [[nodiscard]]
+        constexpr static uint16_t port_address(size_t const a_universe_number) noexcept {
+            return static_cast<uint16_t>((a_universe_number - 1) & 0x7FFF);
+        }
+
+        /**
+         * @brief Get the universe number output on a port address.
+         *
+         * @param a_net      The net, 0-127.
+         * @param a_sub_net  The sub-net, 0-15.
+         * @param a_universe The universe within the sub-net, 0-15.
+         *
+         * @return The universe number, for routing a universe to net:sub-net:universe.
+         */
+        [[nodiscard]]
+        constexpr static size_t universe_number(size_t const a_net, size_t const a_sub_net, size_t const a_universe) noexcept {
+            return ((a_net & 0x7F) << 8 | (a_sub_net & 0x0F) << 4 | (a_universe & 0x0F)) + 1;
+        }
+
+    private:
+        /// Patch the header of the packet for a universe and point it at the universe data.
+        universe_packet& prepare_packet(size_t a_universe_number, address::universe const& a_universe);
+
+        /// Point every packet at the nodes outputting its port address.
+        void resolve_destinations();
+
+        /// Send an ArtPoll if one is due and take in any ArtPollReply received since.
+        void discover_nodes(clock::time_point a_now);
+
+        /// Handle one ArtPollReply.
+        void process_poll_reply(std::span<uint8_t const> a_reply, sockaddr_in const& a_sender, clock::time_point a_now);
+
+        /// Send a small packet to every destination of the frame, or broadcast it.
+        void send_to_all(std::span<uint8_t const> a_packet);
+
+        /// Send one packet to an address, counting it if it fails.
+        void send_to(void const* a_data, size_t a_size, sockaddr_in const& a_address);
+    };
+
+}
+
+#endif //MASTER_SERVER_ARTNET_HPP
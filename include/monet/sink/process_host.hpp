@@ -0,0 +1,228 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_SINK_PROCESS_HOST_HPP
+#define MASTER_SERVER_SINK_PROCESS_HOST_HPP
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <span>
+
+#include <sys/types.h>
+
+#include "sink.hpp"
+
+namespace monet::sink {
+
+    /**
+     * @brief Runs a sink in a child process, fed through a lock-free ring in shared memory.
+     *
+     * A crash or a blocking call in the hosted sink only takes down or stalls the child. The server side copies each
+     * frame into the next free slot of the ring and publishes its index. The child is woken on the index, hands the
+     * sink the universes straight from the ring, and advances the consumed index once they are sent. Neither side
+     * ever waits for the other: when the ring is full, frames are dropped rather than queued.
+     *
+     * The host supervises the child on every frame. If it exited, or has not sent a heartbeat within the stall
+     * timeout, it is killed and restarted from the frame after the one it was sending, so a crash costs at most that
+     * one frame. A child that keeps failing soon after it was started is restarted after a delay doubled on each
+     * failure, so a sink that cannot start does not fork on every frame.
+     *
+     * The hosted sink is created by a factory in the child, after the fork, so it owns its sockets and devices. It
+     * outputs every universe it is handed; which universes are due is decided on the server side.
+     *
+     * @warning The child is forked from the running, multi-threaded server, and only the forking thread exists in it.
+     *          The factory and the hosted sink must be safe to run after such a fork: they must not use the server
+     *          beyond reading its configuration, wait on other threads, or take locks another thread of the server
+     *          may have held at the time, and should create everything they need themselves.
+     */
+    class process_host : public sink {
+    public:
+        using factory = std::function<std::unique_ptr<sink>()>;
+
+    private:
+        /// Progress of the child in creating the hosted sink.
+        enum child_state : uint32_t {
+            /// The hosted sink is being created and initialized.
+            starting,
+            /// The hosted sink is sending frames.
+            ready,
+            /// The hosted sink could not be created or initialized, and the child is exiting.
+            failed
+        };
+
+        /// Indices shared by the server and the child.
+        struct ring_control {
+            /// Amount of frames published. Frame n is held in slot n % slot count. The child waits on it.
+            alignas(cache_line_size) std::atomic<uint32_t> published;
+            /// Amount of frames the child has finished with.
+            alignas(cache_line_size) std::atomic<uint32_t> consumed;
+            /// The frame the child is sending, plus one, or equal to the consumed index while idle.
+            std::atomic<uint32_t> sending;
+            /// When the child was last alive, as steady clock nanoseconds.
+            std::atomic<int64_t> heartbeat;
+            /// Set to ask the child to exit.
+            std::atomic<uint32_t> stop;
+            /// The child_state of the child. The server waits on it when starting the first child.
+            std::atomic<uint32_t> state;
+        };
+
+        /// A universe in a ring slot.
+        struct ring_universe {
+            size_t number;
+            address::universe universe;
+        };
+
+        /// Precedes the universes of a ring slot.
+        struct alignas(cache_line_size) ring_slot {
+            size_t universe_count;
+        };
+
+        factory m_factory;
+        /// The most universes a frame was asked to hold at construction.
+        size_t m_requested_universe_capacity;
+        /// The most universes a frame holds, at least as many as the server had when the ring was mapped.
+        size_t m_universe_capacity;
+        clock::duration m_stall_timeout;
+        server* m_server;
+
+        /// The anonymous shared mapping holding the control block and the ring slots.
+        void* m_mapping;
+        size_t m_mapping_size;
+        size_t m_slot_size;
+
+        pid_t m_child;
+        /// When the child was last started.
+        clock::time_point m_child_started;
+        /// Delay before the next restart, doubled each time a child fails soon after it was started.
+        clock::duration m_restart_delay;
+        /// The child is not restarted before this time.
+        clock::time_point m_restart_time;
+        std::atomic<size_t> m_restarts;
+        std::atomic<size_t> m_dropped_frames;
+
+    public:
+        /**
+         * @brief Create an out-of-process sink host.
+         *
+         * @param a_factory           Creates the hosted sink. Called in the child, every time it is started, so must
+         *                            be safe to call after a fork. Exceptions it throws fail the child.
+         * @param a_universe_capacity The most universes a frame can hold, raised to the amount of universes of the
+         *                            server when initialized. Further universes are not output.
+         * @param a_stall_timeout     Time without a heartbeat after which the child is killed and restarted.
+         */
+        explicit process_host(
+            factory a_factory,
+            size_t a_universe_capacity = default_process_host_universes,
+            clock::duration a_stall_timeout = default_process_host_stall_timeout
+        ) noexcept;
+
+        ~process_host() override;
+
+        /**
+         * @brief Map the ring, start the child, and wait for it to initialize the hosted sink.
+         *
+         * @param a_server A reference to the host server instance, which the hosted sink is initialized with.
+         *
+         * @return False if the ring could not be mapped, or the child could not create and initialize the hosted
+         *         sink within the start timeout. In the latter case the ring stays mapped and supervise() keeps
+         *         restarting the child, backing off while it fails, so a sink whose device is not ready yet starts
+         *         once it is.
+         */
+        bool initialize(server& a_server) override;
+
+        /**
+         * @brief Stop the child and unmap the ring.
+         */
+        void deinitialize() override;
+
+        /**
+         * @brief Output a single universe as a frame of its own.
+         *
+         * @param a_universe_number The universe number.
+         * @param a_universe        The universe.
+         */
+        void send_universe(size_t a_universe_number, address::universe const& a_universe) override;
+
+        /**
+         * @brief Hand a frame to the child.
+         *
+         * @param a_universes The universes output in the frame.
+         */
+        void send_frame(std::span<frame_universe const> a_universes) override;
+
+        /**
+         * @brief Restart the child if it exited or stalled. Called on every frame.
+         */
+        void supervise();
+
+        /**
+         * @brief Get the process ID of the child, or 0 if it is not running.
+         */
+        [[nodiscard]]
+        pid_t child() const noexcept {
+            return m_child;
+        }
+
+        /**
+         * @brief Get the amount of frames published that the child has not finished with.
+         */
+        [[nodiscard]]
+        size_t pending_frames() const noexcept;
+
+        /**
+         * @brief Get the amount of times the child has been restarted.
+         */
+        [[nodiscard]]
+        size_t restarts() const noexcept {
+            return m_restarts.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Get the amount of frames dropped, because the ring was full or the child died sending them, or cut
+         *        short because they held more universes than a frame can.
+         */
+        [[nodiscard]]
+        size_t dropped_frames() const noexcept {
+            return m_dropped_frames.load(std::memory_order_relaxed);
+        }
+
+    private:
+        [[nodiscard]]
+        ring_control& control() const noexcept {
+            return *static_cast<ring_control*>(m_mapping);
+        }
+
+        /// Get a slot of the ring.
+        [[nodiscard]]
+        ring_slot& slot_at(size_t const a_index) const noexcept {
+            return *reinterpret_cast<ring_slot*>(static_cast<uint8_t*>(m_mapping) + sizeof(ring_control) + a_index % process_host_ring_slots * m_slot_size);
+        }
+
+        /// Get the universes of a ring slot.
+        [[nodiscard]]
+        static ring_universe* slot_universes(ring_slot& a_slot) noexcept {
+            return reinterpret_cast<ring_universe*>(&a_slot + 1);
+        }
+
+        /// Fork the child.
+        bool start_child();
+
+        /// Wait for the child to initialize the hosted sink. Returns false if it failed or did not in time.
+        bool wait_for_child(clock::duration a_timeout);
+
+        /// Kill the child if it is still running and wait for it.
+        void stop_child(clock::duration a_timeout);
+
+        /// Create the hosted sink and send frames from the ring until asked to stop. Runs in the child.
+        [[noreturn]]
+        void run_child();
+
+        /// Send frames from the ring to the hosted sink until asked to stop. Runs in the child.
+        void send_frames(sink& a_hosted);
+    };
+
+}
+
+#endif //MASTER_SERVER_SINK_PROCESS_HOST_HPP
@@ -0,0 +1,135 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_RECORDER_HPP
+#define MASTER_SERVER_RECORDER_HPP
+
+#include <filesystem>
+#include <span>
+
+#include "../recording.hpp"
+#include "sink.hpp"
+
+namespace monet::sink {
+
+    /**
+     * @brief Records every frame output to a memory-mapped, append-only recording file.
+     *
+     * Each universe output is written as one fixed-size recording::record straight into the mapping. The file is
+     * grown by recording_growth_records at a time, so frames are written without syscalls or allocations. Every index
+     * interval, the recorder makes every universe due for output and starts the next frame with an index entry, so
+     * readers can seek and rebuild the state of every universe from the last index entry.
+     *
+     * Unchanged universes are not repeated, as the file cannot lose frames the way the network can.
+     */
+    class recorder : public sink {
+        std::filesystem::path m_path;
+        clock::duration m_index_interval;
+
+        int m_file;
+        void* m_mapping;
+        /// Amount of records space is mapped for.
+        size_t m_capacity;
+        /// Amount of records written.
+        size_t m_record_count;
+        uint64_t m_frame_count;
+        /// Whether the file could not be grown and recording stopped.
+        bool m_full;
+
+        clock::time_point m_start_time;
+        clock::time_point m_last_index;
+        /// Whether the next frame is output in full and starts with an index entry.
+        bool m_index_due;
+
+    public:
+        /**
+         * @brief Create a recorder.
+         *
+         * @param a_path           The recording file, replaced when the recorder is initialized.
+         * @param a_index_interval The interval between index entries.
+         */
+        explicit recorder(std::filesystem::path a_path, clock::duration a_index_interval = recording_index_interval) noexcept;
+
+        ~recorder() override;
+
+        /**
+         * @brief Create the recording file and map it.
+         *
+         * @param a_server A reference to the host server instance.
+         */
+        bool initialize(server& a_server) override;
+
+        /**
+         * @brief Trim the recording file to the records written and unmap it.
+         */
+        void deinitialize() override;
+
+        /**
+         * @brief Record a single universe as a frame of its own.
+         *
+         * @param a_universe_number The universe number.
+         * @param a_universe        The universe.
+         */
+        void send_universe(size_t a_universe_number, address::universe const& a_universe) override;
+
+        /**
+         * @brief Record a frame.
+         *
+         * @param a_universes The universes output in the frame.
+         */
+        void send_frame(std::span<frame_universe const> a_universes) override;
+
+        /**
+         * @brief Get the recording file.
+         */
+        [[nodiscard]]
+        std::filesystem::path const& path() const noexcept {
+            return m_path;
+        }
+
+        /**
+         * @brief Get the amount of records written, including index entries.
+         */
+        [[nodiscard]]
+        size_t record_count() const noexcept {
+            return m_record_count;
+        }
+
+        /**
+         * @brief Get the amount of frames written.
+         */
+        [[nodiscard]]
+        uint64_t frame_count() const noexcept {
+            return m_frame_count;
+        }
+
+        /**
+         * @brief Check whether recording stopped because the file could not be grown.
+         */
+        [[nodiscard]]
+        bool full() const noexcept {
+            return m_full;
+        }
+
+    private:
+        /// Get the header at the start of the mapping.
+        recording::file_header& header() noexcept {
+            return *static_cast<recording::file_header*>(m_mapping);
+        }
+
+        /// Get the record at an index within the mapping.
+        recording::record& record_at(size_t const a_index) noexcept {
+            return reinterpret_cast<recording::record*>(static_cast<uint8_t*>(m_mapping) + sizeof(recording::file_header))[a_index];
+        }
+
+        /// Make room for an amount of records, growing the file if needed.
+        bool reserve(size_t a_count);
+
+        /// Map the file for an amount of records.
+        bool map(size_t a_capacity);
+    };
+
+}
+
+#endif //MASTER_SERVER_RECORDER_HPP
@@ -5,24 +5,45 @@
 #ifndef MASTER_SERVER_SACN_HPP
 #define MASTER_SERVER_SACN_HPP
 
+#include <atomic>
 #include <memory>
 
 #include <e131.h>
 
+#if defined(__linux__)
+#include <sys/socket.h>
+#endif
+
 #include "../server.hpp"
 #include "sink.hpp"
 
 namespace monet::sink {
     class sacn : public sink {
+        /// A universe's destination address and reusable packet.
+        using universe_packet = std::pair<e131_addr_t, e131_packet_t>;
+
         int m_socket_id;
         std::string m_source_name;
-        std::unordered_map<size_t, std::unique_ptr<std::pair<e131_addr_t, e131_packet_t>>> m_multicast_packets;
+        std::unordered_map<size_t, std::unique_ptr<universe_packet>> m_multicast_packets;
+
+        /// Packets built for the frame being sent.
+        std::vector<universe_packet*> m_frame_packets;
+
+#if defined(__linux__)
+        /// Message headers and buffers for batched transmission, reused between frames.
+        std::vector<mmsghdr> m_frame_messages;
+        std::vector<iovec> m_frame_buffers;
+#endif
+
+        /// Packets that failed to send.
+        std::atomic<size_t> m_send_errors;
 
     public:
         explicit sacn(std::string a_source_name = "MoNET") noexcept :
             sink("sacn"),
             m_socket_id(0),
-            m_source_name(std::move(a_source_name))
+            m_source_name(std::move(a_source_name)),
+            m_send_errors(0)
         {}
 
         std::string_view source_name() const noexcept {
@@ -53,6 +74,29 @@ namespace monet::sink {
          */
         void send_universe(size_t a_universe_number, address::universe const& a_universe) override;
 
+        /**
+         * @brief Output a set of universes for one frame.
+         *
+         * @param a_universes The universes to output.
+         *
+         * Builds the packets for every universe first and transmits them with a single sendmmsg() call where
+         * available, falling back to one send per packet otherwise. With sendmmsg(), the data is gathered straight
+         * from the universes instead of being copied into the packets.
+         */
+        void send_frame(std::span<frame_universe const> a_universes) override;
+
+        /**
+         * @brief Get the amount of packets that failed to send.
+         *
+         * A packet failing to send is skipped; the rest of the frame is still sent.
+         *
+         * @return The send error count.
+         */
+        [[nodiscard]]
+        size_t send_errors() const noexcept {
+            return m_send_errors.load(std::memory_order_relaxed);
+        }
+
     private:
         /**
          * @brief Initialize a sACN packet and address for a universe.
@@ -60,6 +104,25 @@ namespace monet::sink {
          * @param a_universe The universe number.
          */
         decltype(m_multicast_packets)::iterator initialize_universe_packet(size_t a_universe);
+
+        /**
+         * @brief Get the destination address and packet for a universe, initializing them if needed.
+         *
+         * @param a_universe_number The universe number.
+         *
+         * @return The destination address and packet.
+         */
+        universe_packet& fetch_packet(size_t a_universe_number);
+
+        /**
+         * @brief Copy universe data into the packet for a universe.
+         *
+         * @param a_universe_number The universe number.
+         * @param a_universe        The universe.
+         *
+         * @return The destination address and packet, ready to be sent.
+         */
+        universe_packet& prepare_packet(size_t a_universe_number, address::universe const& a_universe);
     };
 
 }
@@ -0,0 +1,100 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_SINK_SHARED_MEMORY_HPP
+#define MASTER_SERVER_SINK_SHARED_MEMORY_HPP
+
+#include <span>
+#include <string>
+
+#include "../shared_universes.hpp"
+#include "sink.hpp"
+
+namespace monet::sink {
+
+    /**
+     * @brief Exports every universe to a POSIX shared memory segment for other processes on the same machine.
+     *
+     * The segment holds one shared_universes::shared_universe per universe number behind a header with a frame
+     * counter. Each universe output is written straight from the frame snapshot into its place in the segment under
+     * its sequence lock, and the frame counter is advanced once the frame is complete. Readers, such as
+     * shared_universes::reader, never block the sink and the sink never waits for them.
+     *
+     * The first frame after initializing writes every universe. After that, only universes that changed are written,
+     * as the segment holds the last state of every universe.
+     */
+    class shared_memory : public sink {
+        std::string m_name;
+        int m_file;
+        void* m_mapping;
+        uint64_t m_frame;
+
+    public:
+        /**
+         * @brief Create a shared memory export.
+         *
+         * @param a_name The name of the segment, starting with a slash.
+         */
+        explicit shared_memory(std::string a_name = default_shared_universes_name) noexcept;
+
+        ~shared_memory() override;
+
+        /**
+         * @brief Create the segment and map it, replacing any segment of the same name.
+         *
+         * @param a_server A reference to the host server instance.
+         */
+        bool initialize(server& a_server) override;
+
+        /**
+         * @brief Unmap and remove the segment. Readers that have it mapped keep the last frame.
+         */
+        void deinitialize() override;
+
+        /**
+         * @brief Export a single universe as a frame of its own.
+         *
+         * @param a_universe_number The universe number.
+         * @param a_universe        The universe.
+         */
+        void send_universe(size_t a_universe_number, address::universe const& a_universe) override;
+
+        /**
+         * @brief Export a frame.
+         *
+         * @param a_universes The universes output in the frame.
+         */
+        void send_frame(std::span<frame_universe const> a_universes) override;
+
+        /**
+         * @brief Get the name of the segment.
+         */
+        [[nodiscard]]
+        std::string const& name() const noexcept {
+            return m_name;
+        }
+
+        /**
+         * @brief Get the amount of frames exported.
+         */
+        [[nodiscard]]
+        uint64_t frame_count() const noexcept {
+            return m_frame;
+        }
+
+    private:
+        /// Get the header at the start of the segment.
+        shared_universes::segment_header& header() noexcept {
+            return *static_cast<shared_universes::segment_header*>(m_mapping);
+        }
+
+        /// Get a universe in the segment.
+        shared_universes::shared_universe& universe_at(size_t const a_universe) noexcept {
+            return reinterpret_cast<shared_universes::shared_universe*>(static_cast<uint8_t*>(m_mapping) + sizeof(shared_universes::segment_header))[a_universe];
+        }
+    };
+
+}
+
+#endif //MASTER_SERVER_SINK_SHARED_MEMORY_HPP
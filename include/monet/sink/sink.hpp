@@ -7,6 +7,12 @@
 
 #include <cstdint>
 #include <span>
+#include <chrono>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+#include "../address/universe.hpp"
 
 namespace monet {
     class server;
@@ -14,6 +20,16 @@ namespace monet {
 
 namespace monet::sink {
 
+    /**
+     * @brief A universe to be output as part of a frame.
+     */
+    struct frame_universe {
+        /// The universe number.
+        size_t number;
+        /// The universe.
+        address::universe const* universe;
+    };
+
     /**
      * @brief An interface class for address universe sinks.
      *
@@ -22,11 +38,35 @@ namespace monet::sink {
      * sACN or a physical device like a DMX controller.
      */
     class sink {
+    public:
+        using clock = std::chrono::steady_clock;
+
+    private:
+        /// Output bookkeeping for one universe.
+        struct universe_output_state {
+            /// The universe generation last output.
+            uint64_t generation = std::numeric_limits<uint64_t>::max();
+            /// When the universe was last output.
+            clock::time_point last_output{};
+            /// Amount of times the universe has been output since it last changed.
+            size_t repeats = 0;
+        };
+
         std::string_view m_name;
 
+        /// Output bookkeeping indexed by universe table slot.
+        std::vector<universe_output_state> m_output_states;
+        /// Interval at which unchanged universes are resent.
+        clock::duration m_keep_alive_interval;
+        /// Amount of times a universe is resent every frame after it stops changing.
+        size_t m_unchanged_repeats;
+
     protected:
         explicit sink(std::string_view a_name) noexcept :
-            m_name(a_name)
+            m_name(a_name),
+            m_output_states(),
+            m_keep_alive_interval(default_sink_keep_alive_interval),
+            m_unchanged_repeats(default_sink_unchanged_repeats)
         {}
 
     public:
@@ -60,6 +100,89 @@ namespace monet::sink {
          */
         virtual void send_universe(size_t a_universe_number, address::universe const& a_universe) = 0;
 
+        /**
+         * @brief Output a set of universes for one frame.
+         *
+         * @param a_universes The universes to output, as universe number and universe pairs.
+         *
+         * The server calls this once per frame with every universe that is due. The default implementation calls
+         * send_universe() for each universe; sinks that can batch transmission should override it.
+         */
+        virtual void send_frame(std::span<frame_universe const> a_universes) {
+            for (auto const& [universe_number, universe] : a_universes) {
+                send_universe(universe_number, *universe);
+            }
+        }
+
+        /**
+         * @brief Check whether a universe needs to be output this frame.
+         *
+         * @param a_slot     The universe table slot of the universe.
+         * @param a_universe The universe.
+         * @param a_now      The time of the frame.
+         *
+         * @return True if the universe changed since this sink last output it, has not yet been repeated the
+         *         configured amount of times since it stopped changing, or is due for a keep-alive.
+         */
+        [[nodiscard]]
+        bool output_due(size_t a_slot, address::universe const& a_universe, clock::time_point a_now);
+
+        /**
+         * @brief Record that a universe has been output.
+         *
+         * @param a_slot     The universe table slot of the universe.
+         * @param a_universe The universe.
+         * @param a_now      The time of the frame.
+         */
+        void mark_output(size_t a_slot, address::universe const& a_universe, clock::time_point a_now) noexcept;
+
+        /**
+         * @brief Make every universe due for output in the next frame, whether it changed or not.
+         */
+        void reset_output_states() noexcept {
+            for (auto& state : m_output_states) {
+                state = {};
+            }
+        }
+
+        /**
+         * @brief Get the interval at which unchanged universes are resent.
+         *
+         * @return The keep-alive interval.
+         */
+        [[nodiscard]]
+        clock::duration keep_alive_interval() const noexcept {
+            return m_keep_alive_interval;
+        }
+
+        /**
+         * @brief Set the interval at which unchanged universes are resent.
+         *
+         * @param a_interval The new keep-alive interval.
+         */
+        void set_keep_alive_interval(clock::duration const a_interval) noexcept {
+            m_keep_alive_interval = a_interval;
+        }
+
+        /**
+         * @brief Get the amount of times a universe is resent every frame after it stops changing.
+         *
+         * @return The amount of repeats.
+         */
+        [[nodiscard]]
+        size_t unchanged_repeats() const noexcept {
+            return m_unchanged_repeats;
+        }
+
+        /**
+         * @brief Set the amount of times a universe is resent every frame after it stops changing.
+         *
+         * @param a_repeats The new amount of repeats.
+         */
+        void set_unchanged_repeats(size_t const a_repeats) noexcept {
+            m_unchanged_repeats = a_repeats;
+        }
+
         /**
          * @brief Get the sink interface name.
          *
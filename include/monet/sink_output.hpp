@@ -0,0 +1,286 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_SINK_OUTPUT_HPP
+#define MASTER_SERVER_SINK_OUTPUT_HPP
+
+#include <atomic>
+#include <chrono>
+#include <compare>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "sink/sink.hpp"
+#include "frame_exchange.hpp"
+#include "frame_scheduler.hpp"
+#include "frame_snapshot.hpp"
+
+namespace monet {
+
+    /**
+     * @brief Drives one sink from the rendered frame snapshots on an output thread of its own.
+     *
+     * Every sink output reads the same snapshots, each at its own framerate, taking the newest one on every tick.
+     * A sink that takes longer than a frame to send only skips snapshots itself; the render thread and the other
+     * sinks carry on regardless. Skipped snapshots and the latency from rendering to the end of sending are counted
+     * per sink output.
+     *
+     * Universes can be routed to other universe numbers of the sink, or mirrored to several. Every universe a
+     * universe is routed to is handed to the sink as the same snapshot universe, so mirrors are never copied.
+     */
+    class sink_output {
+    public:
+        using clock = sink::sink::clock;
+
+        /**
+         * @brief A universe output under a universe number of the sink.
+         */
+        struct route {
+            /// The universe number in the universe table.
+            uint16_t universe_number;
+            /// The universe number the sink outputs it as.
+            uint16_t output_universe_number;
+
+            auto operator <=> (route const&) const noexcept = default;
+        };
+
+    private:
+        std::unique_ptr<sink::sink> m_sink;
+        /// Paces the output thread.
+        frame_scheduler m_scheduler;
+        std::thread m_thread;
+        std::atomic_bool m_running;
+
+        /// Routes sorted by universe number, or empty to output every universe as itself.
+        std::vector<route> m_routes;
+
+        /// The exchange slot of the snapshot being output, or frame_exchange::npos.
+        size_t m_slot;
+        /// Frame index of the snapshot last output, if any has been.
+        std::optional<uint64_t> m_frame_index;
+        /// Universes due for output in the current frame. Kept between frames to reuse its allocation.
+        std::vector<sink::frame_universe> m_frame_universes;
+
+        std::atomic<size_t> m_output_frames;
+        std::atomic<size_t> m_skipped_frames;
+        /// Time from rendering the last snapshot output to having sent it, in nanoseconds.
+        std::atomic<int64_t> m_latency;
+        std::atomic<int64_t> m_max_latency;
+
+    public:
+        /**
+         * @brief Create a sink output.
+         *
+         * @param a_sink      The sink. Its lifetime is managed by the sink output.
+         * @param a_framerate The framerate the sink is output at.
+         */
+        sink_output(sink::sink* a_sink, size_t a_framerate) noexcept;
+
+        ~sink_output();
+
+        sink_output(sink_output const&) = delete;
+        sink_output(sink_output&&)      = delete;
+
+        sink_output& operator = (sink_output const&) = delete;
+        sink_output& operator = (sink_output&&)      = delete;
+
+        /**
+         * @brief Initialize the sink and start the output thread.
+         *
+         * @param a_server The host server instance.
+         * @param a_frames The exchange rendered snapshots are published to.
+         *
+         * Output is offset from the start of the render schedule by half a frame.
+         */
+        void start(server& a_server, frame_exchange<frame_snapshot>& a_frames);
+
+        /**
+         * @brief Stop the output thread and deinitialize the sink.
+         *
+         * @param a_frames The exchange passed to start().
+         */
+        void stop(frame_exchange<frame_snapshot>& a_frames);
+
+        /**
+         * @brief Output the newest snapshot once on the calling thread.
+         *
+         * @param a_frames The exchange rendered snapshots are published to.
+         *
+         * If no new snapshot has been published, the previous one is used again so keep-alives continue while
+         * rendering stalls.
+         */
+        void output_frame(frame_exchange<frame_snapshot>& a_frames);
+
+        /**
+         * @brief Give back the snapshot held, for example before the exchange is resized.
+         *
+         * @param a_frames The exchange the snapshot was taken from.
+         */
+        void release(frame_exchange<frame_snapshot>& a_frames) noexcept;
+
+        /**
+         * @brief Get the sink.
+         *
+         * @return The sink.
+         */
+        [[nodiscard]]
+        sink::sink& sink_interface() noexcept {
+            return *m_sink;
+        }
+
+        /**
+         * @brief Get the sink.
+         *
+         * @return The sink.
+         */
+        [[nodiscard]]
+        sink::sink const& sink_interface() const noexcept {
+            return *m_sink;
+        }
+
+        /**
+         * @brief Get the scheduler pacing the output thread.
+         *
+         * @return The frame scheduler.
+         */
+        [[nodiscard]]
+        frame_scheduler& scheduler() noexcept {
+            return m_scheduler;
+        }
+
+        /**
+         * @brief Get the scheduler pacing the output thread.
+         *
+         * @return The frame scheduler.
+         */
+        [[nodiscard]]
+        frame_scheduler const& scheduler() const noexcept {
+            return m_scheduler;
+        }
+
+        /**
+         * @brief Limit output to a set of universes, each output as itself.
+         *
+         * @param a_universes The universe numbers to output, or empty to output every universe.
+         *
+         * @note Must not be called while the server is running.
+         */
+        void set_routes(std::span<size_t const> a_universes);
+
+        /**
+         * @brief Output a universe under a universe number of the sink.
+         *
+         * @param a_universe_number        The universe number in the universe table.
+         * @param a_output_universe_number The universe number the sink outputs it as.
+         *
+         * Routing a universe more than once mirrors it. Once any route has been added, universes without a route are
+         * no longer output.
+         *
+         * @note Throws std::out_of_range if either universe number is outside of 1-63999. Must not be called while
+         *       the server is running.
+         */
+        void add_route(size_t a_universe_number, size_t a_output_universe_number);
+
+        /**
+         * @brief Output a block of consecutive universes under another block of universe numbers of the sink.
+         *
+         * @param a_first_universe_number        The first universe number in the universe table.
+         * @param a_count                        The amount of universes.
+         * @param a_first_output_universe_number The universe number the sink outputs the first universe as.
+         *
+         * @note Throws std::out_of_range if any universe number is outside of 1-63999. Must not be called while the
+         *       server is running.
+         */
+        void add_routes(size_t a_first_universe_number, size_t a_count, size_t a_first_output_universe_number);
+
+        /**
+         * @brief Remove every route, outputting every universe as itself.
+         *
+         * @note Must not be called while the server is running.
+         */
+        void clear_routes() noexcept {
+            m_routes.clear();
+        }
+
+        /**
+         * @brief Get the routes of a universe.
+         *
+         * @param a_universe_number The universe number in the universe table.
+         *
+         * @return The routes of the universe, or none if it is not output. Empty if every universe is output as
+         *         itself; see routed().
+         */
+        [[nodiscard]]
+        std::span<route const> routes(size_t a_universe_number) const noexcept;
+
+        /**
+         * @brief Get every route.
+         *
+         * @return The routes sorted by universe number, or none if every universe is output as itself.
+         */
+        [[nodiscard]]
+        std::span<route const> routes() const noexcept {
+            return m_routes;
+        }
+
+        /**
+         * @brief Check whether a universe is output.
+         *
+         * @param a_universe_number The universe number.
+         *
+         * @return True if the universe is output by this sink.
+         */
+        [[nodiscard]]
+        bool routed(size_t const a_universe_number) const noexcept {
+            return m_routes.empty() || !routes(a_universe_number).empty();
+        }
+
+        /**
+         * @brief Get the amount of snapshots output.
+         *
+         * @return The amount of frames output, including those repeated while rendering stalled.
+         */
+        [[nodiscard]]
+        size_t output_frames() const noexcept {
+            return m_output_frames.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Get the amount of rendered snapshots the sink never output because it fell behind.
+         *
+         * @return The amount of skipped frames.
+         */
+        [[nodiscard]]
+        size_t skipped_frames() const noexcept {
+            return m_skipped_frames.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Get the time from rendering the last snapshot output to having sent it.
+         *
+         * @return The latency of the last frame output.
+         */
+        [[nodiscard]]
+        std::chrono::nanoseconds latency() const noexcept {
+            return std::chrono::nanoseconds(m_latency.load(std::memory_order_relaxed));
+        }
+
+        /**
+         * @brief Get the highest latency of any frame output since the sink output was started.
+         *
+         * @return The maximum latency.
+         */
+        [[nodiscard]]
+        std::chrono::nanoseconds max_latency() const noexcept {
+            return std::chrono::nanoseconds(m_max_latency.load(std::memory_order_relaxed));
+        }
+    };
+
+}
+
+#endif //MASTER_SERVER_SINK_OUTPUT_HPP
@@ -0,0 +1,150 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_SOURCE_REPLAY_HPP
+#define MASTER_SERVER_SOURCE_REPLAY_HPP
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+#include "../address/merge_engine.hpp"
+#include "../show_file.hpp"
+
+namespace monet::source {
+
+    /**
+     * @brief Plays a show file back into the merge engine.
+     *
+     * Frames are decoded by a recording::show_player and only the addresses each frame changed are written into a
+     * merge source of their own, so a replayed show merges with the live output like any other source. Playback runs
+     * on a thread of its own at the cadence the show was recorded at, scaled by a speed, or frame by frame through
+     * step() for tests and offline rendering.
+     */
+    class replay {
+    public:
+        using clock = std::chrono::steady_clock;
+
+    private:
+        address::merge_engine& m_merge;
+        address::merge_source& m_source;
+        recording::show_player m_player;
+
+        std::thread m_playback_thread;
+        std::atomic_bool m_running;
+        /// Whether the playback thread is still outputting frames.
+        std::atomic_bool m_playing;
+        /// Playback speed, as a multiple of the recorded cadence, or 0 to play as fast as possible.
+        double m_speed;
+
+    public:
+        /**
+         * @brief Create a replay source.
+         *
+         * @param a_merge    The merge engine the show is merged by.
+         * @param a_priority The merge priority of the show.
+         *
+         * @note Creates a merge source, so must not be constructed while the server is running.
+         */
+        explicit replay(address::merge_engine& a_merge, uint8_t a_priority = default_merge_priority);
+
+        /**
+         * @brief Stop playback and destroy the merge source.
+         *
+         * @note Destroys a merge source, so must not be destroyed while the server is running.
+         */
+        ~replay();
+
+        replay(replay const&) = delete;
+        replay(replay&&)      = delete;
+
+        replay& operator = (replay const&) = delete;
+        replay& operator = (replay&&)      = delete;
+
+        /**
+         * @brief Open a show file, releasing anything a previous show set.
+         *
+         * @param a_file The show file.
+         *
+         * @return True if the file is a valid show file.
+         */
+        bool open(std::filesystem::path const& a_file);
+
+        /**
+         * @brief Stop playback, close the show file, and release every address the show set.
+         */
+        void close();
+
+        /**
+         * @brief Decode the next frame and write the addresses it changed.
+         *
+         * @return True if a frame was output or false at the end of the show.
+         *
+         * @note Must not be called while playing.
+         */
+        bool step();
+
+        /**
+         * @brief Move to a point in the show and write the state of every universe at that point.
+         *
+         * @param a_time Time since the start of the show.
+         *
+         * @note Must not be called while playing.
+         */
+        void seek(std::chrono::nanoseconds a_time);
+
+        /**
+         * @brief Start playing from the current point on a thread of its own.
+         *
+         * @param a_speed Playback speed, as a multiple of the recorded cadence, or 0 to play as fast as possible.
+         *
+         * @return True if playback started.
+         *
+         * Playback that ended at the end of the show can be started again, for example after seeking back.
+         */
+        bool start(double a_speed = 1.0);
+
+        /**
+         * @brief Stop playing. The last frame output is held.
+         */
+        void stop();
+
+        /**
+         * @brief Check whether the playback thread is still outputting frames.
+         */
+        [[nodiscard]]
+        bool playing() const noexcept {
+            return m_playing.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Get the show player.
+         *
+         * @note Must not be used while playing.
+         */
+        [[nodiscard]]
+        recording::show_player const& player() const noexcept {
+            return m_player;
+        }
+
+        /**
+         * @brief Get the merge source the show is written into.
+         */
+        [[nodiscard]]
+        address::merge_source& merge_source() noexcept {
+            return m_source;
+        }
+
+    private:
+        /// Write the addresses changed by the frame decoded last into the merge source.
+        void output();
+
+        /// Output frames at their recorded times until stopped or the show ends.
+        void playback_loop();
+    };
+
+}
+
+#endif //MASTER_SERVER_SOURCE_REPLAY_HPP
@@ -0,0 +1,179 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_SOURCE_SACN_HPP
+#define MASTER_SERVER_SOURCE_SACN_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <span>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <e131.h>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#endif
+
+#include "../address/merge_engine.hpp"
+
+namespace monet::source {
+
+    /**
+     * @brief Receives sACN (E1.31) from other consoles and media servers into the merge engine.
+     *
+     * The input counterpart of sink::sacn. A dedicated receive thread joins the multicast groups of the configured
+     * universes and reads packets in batches with recvmmsg() where available, straight into a ring of packet buffers.
+     * Packets are validated with e131_pkt_validate() and out-of-order packets dropped with e131_pkt_discard(), per
+     * remote source and universe. The DMX data of each remaining packet is written from its receive buffer directly
+     * into the merge source of its remote source, at the priority the remote source sends for that universe, so sACN
+     * merging between remote sources and with the local output is done by the merge engine.
+     *
+     * Remote sources are told apart by CID. Each is assigned one of a fixed set of merge sources created up front,
+     * and gives it back when it terminates the stream or goes silent for the E1.31 data loss timeout.
+     */
+    class sacn {
+    public:
+        using clock = std::chrono::steady_clock;
+
+    private:
+        /// A remote sender, identified by its CID.
+        struct remote_source {
+            std::array<uint8_t, 16> cid{};
+            /// The merge source the data of the remote source is written into.
+            address::merge_source* merge_source = nullptr;
+            /// The last sequence number and packet time per universe.
+            std::unordered_map<size_t, std::pair<uint8_t, clock::time_point>> universes;
+        };
+
+        address::merge_engine& m_merge;
+        /// One merge source per remote source slot.
+        std::vector<address::merge_source*> m_merge_sources;
+        /// Remote sources currently sending. Receive thread only.
+        std::vector<remote_source> m_remote_sources;
+
+        int m_socket_id;
+        std::thread m_receive_thread;
+        std::atomic_bool m_running;
+        /// Whether each universe number is received.
+        std::vector<bool> m_universes;
+
+        /// Packet buffers received into, one per message of a batch.
+        std::vector<e131_packet_t> m_packets;
+#if defined(__linux__)
+        std::vector<mmsghdr> m_messages;
+        std::vector<iovec> m_buffers;
+#endif
+
+        std::atomic<size_t> m_received_packets;
+        std::atomic<size_t> m_invalid_packets;
+        std::atomic<size_t> m_out_of_sequence_packets;
+        std::atomic<size_t> m_dropped_packets;
+
+    public:
+        /**
+         * @brief Create a receiver.
+         *
+         * @param a_merge        The merge engine received data is merged by.
+         * @param a_source_slots The amount of remote sources that can send at once. Packets from further remote
+         *                       sources are dropped until one stops.
+         *
+         * @note Creates merge sources, so must not be constructed while the server is running.
+         */
+        explicit sacn(address::merge_engine& a_merge, size_t a_source_slots = default_sacn_source_slots);
+
+        /**
+         * @brief Stop the receiver and destroy its merge sources.
+         *
+         * @note Destroys merge sources, so must not be destroyed while the server is running.
+         */
+        ~sacn();
+
+        sacn(sacn const&) = delete;
+        sacn(sacn&&)      = delete;
+
+        sacn& operator = (sacn const&) = delete;
+        sacn& operator = (sacn&&)      = delete;
+
+        /**
+         * @brief Open the socket, join the universes, and start the receive thread.
+         *
+         * @param a_universes The universe numbers to receive.
+         * @param a_port      The UDP port to receive on.
+         *
+         * @return True if the receiver was started. Universes whose multicast group cannot be joined, for example
+         *         without a multicast route, are still received when sent by unicast.
+         */
+        bool start(std::span<size_t const> a_universes, uint16_t a_port = E131_DEFAULT_PORT);
+
+        /**
+         * @brief Stop the receive thread and close the socket. Every remote source is released.
+         */
+        void stop();
+
+        [[nodiscard]]
+        bool running() const noexcept {
+            return m_running.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Get the amount of packets received, including those dropped.
+         *
+         * @return The received packet count.
+         */
+        [[nodiscard]]
+        size_t received_packets() const noexcept {
+            return m_received_packets.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Get the amount of packets that failed validation.
+         *
+         * @return The invalid packet count.
+         */
+        [[nodiscard]]
+        size_t invalid_packets() const noexcept {
+            return m_invalid_packets.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Get the amount of packets discarded for arriving out of sequence.
+         *
+         * @return The out of sequence packet count.
+         */
+        [[nodiscard]]
+        size_t out_of_sequence_packets() const noexcept {
+            return m_out_of_sequence_packets.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Get the amount of valid packets dropped because every remote source slot was taken.
+         *
+         * @return The dropped packet count.
+         */
+        [[nodiscard]]
+        size_t dropped_packets() const noexcept {
+            return m_dropped_packets.load(std::memory_order_relaxed);
+        }
+
+    private:
+        /// Receive and process packets until stopped.
+        void receive_loop();
+
+        /// Process one received packet.
+        void process_packet(e131_packet_t const& a_packet, size_t a_length, clock::time_point a_now);
+
+        /// Release the universes of remote sources that have gone silent, and free their slots.
+        void expire_remote_sources(clock::time_point a_now);
+
+        /// Find the remote source with a CID, assigning it a free slot if it is new.
+        remote_source* fetch_remote_source(uint8_t const* a_cid);
+    };
+
+}
+
+#endif //MASTER_SERVER_SOURCE_SACN_HPP
@@ -0,0 +1,121 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_WORKER_POOL_HPP
+#define MASTER_SERVER_WORKER_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace monet {
+
+    /**
+     * @brief A fixed set of worker threads for splitting per-frame work into independent tasks.
+     *
+     * run() hands out task indices to the workers and the calling thread until every task is done, then returns.
+     * With a thread count of one, no threads are created and tasks run on the calling thread.
+     */
+    class worker_pool {
+        /// Type-erased reference to the task callable of the current run.
+        using task_function = void (*)(void*, size_t);
+
+        std::vector<std::thread> m_threads;
+
+        std::mutex m_mutex;
+        std::condition_variable m_start_condition;
+        std::condition_variable m_done_condition;
+
+        /// The task of the current run.
+        task_function m_task;
+        void* m_task_context;
+        /// Amount of tasks in the current run.
+        size_t m_task_count;
+        /// Next task index to be claimed.
+        std::atomic<size_t> m_next_task;
+        /// Amount of workers still busy with the current run.
+        size_t m_active_workers;
+        /// Incremented for every run so workers can tell a new run from a spurious wake-up.
+        uint64_t m_run_generation;
+        bool m_stopping;
+
+    public:
+        /**
+         * @brief Create a worker pool.
+         *
+         * @param a_thread_count The amount of threads tasks run on, including the thread calling run().
+         */
+        explicit worker_pool(size_t a_thread_count = 1);
+
+        ~worker_pool();
+
+        worker_pool(worker_pool const&) = delete;
+        worker_pool(worker_pool&&)      = delete;
+
+        worker_pool& operator = (worker_pool const&) = delete;
+        worker_pool& operator = (worker_pool&&)      = delete;
+
+        /**
+         * @brief Get the amount of threads tasks run on, including the thread calling run().
+         */
+        [[nodiscard]]
+        size_t thread_count() const noexcept {
+            return m_threads.size() + 1;
+        }
+
+        /**
+         * @brief Change the amount of threads tasks run on, including the thread calling run().
+         *
+         * @param a_thread_count The new amount of threads. Values below one are treated as one.
+         *
+         * @note Must not be called during run().
+         */
+        void set_thread_count(size_t a_thread_count);
+
+        /**
+         * @brief Run a task for every index in [0, a_task_count) and wait for all of them to finish.
+         *
+         * @param a_task_count The amount of tasks.
+         * @param a_task       The callable to invoke with each task index. Invoked concurrently from multiple threads.
+         */
+        template <typename t_task>
+        void run(size_t const a_task_count, t_task&& a_task) {
+            run_tasks(
+                a_task_count,
+                [] (void* const a_context, size_t const a_index) {
+                    (*static_cast<std::remove_reference_t<t_task>*>(a_context))(a_index);
+                },
+                const_cast<void*>(static_cast<void const*>(&a_task))
+            );
+        }
+
+    private:
+        /// Start the worker threads.
+        void start_threads(size_t a_thread_count);
+
+        /// Stop and join the worker threads.
+        void stop_threads();
+
+        /// Run a type-erased task.
+        void run_tasks(size_t a_task_count, task_function a_task, void* a_context);
+
+        /// Claim and run task indices of the current run until none are left.
+        void work() noexcept;
+
+        /**
+         * @brief Worker thread loop.
+         *
+         * @param a_last_generation The run generation when the thread was started. Passed in rather than read by the
+         *                          thread so a run started before the thread is scheduled is not missed.
+         */
+        void worker_main(uint64_t a_last_generation);
+    };
+
+}
+
+#endif //MASTER_SERVER_WORKER_POOL_HPP
@@ -0,0 +1,25 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <iostream>
+
+#include "benchmarks/benchmark.hpp"
+
+int main(int argc, char** argv) {
+    // Run every benchmark, or only those whose names are passed as arguments.
+    for (auto const& benchmark : monet::benchmarks::registry()) {
+        bool selected = argc < 2;
+
+        for (int i = 1; i < argc; ++i) {
+            selected |= benchmark.name == argv[i];
+        }
+
+        if (selected) {
+            std::cout << "== " << benchmark.name << " ==" << std::endl;
+            benchmark.function();
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,57 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <iostream>
+
+#include <monet.hpp>
+
+#include "benchmark.hpp"
+
+namespace {
+
+    /// Universes output every frame, above the 200 a large rig needs at 44Hz.
+    constexpr size_t rig_universes = 256;
+    /// Port nothing listens on, so the benchmark measures the sending side only.
+    constexpr uint16_t benchmark_port = 16455;
+
+    void artnet() {
+        using namespace std::chrono;
+
+        monet::server server;
+        monet::sink::artnet sink("", benchmark_port);
+        std::vector<uint16_t> port_addresses;
+        std::vector<monet::sink::frame_universe> frame;
+
+        for (size_t universe = 1; universe <= rig_universes; ++universe) {
+            port_addresses.push_back(monet::sink::artnet::port_address(universe));
+        }
+
+        sink.set_discovery(false);
+        sink.add_node("127.0.0.1", std::move(port_addresses));
+
+        if (!sink.initialize(server)) {
+            std::cout << "Failed to open the Art-Net socket" << std::endl;
+            return;
+        }
+
+        for (size_t universe = 1; universe <= rig_universes; ++universe) {
+            auto& output = server.get_universe(universe);
+            output.set_address(monet::dmx_data_channel_count, 0);
+            frame.push_back({ universe, &output });
+        }
+
+        auto const time = monet::benchmarks::measure(200, [&] {
+            sink.send_frame(frame);
+        });
+
+        sink.deinitialize();
+
+        std::cout
+            << rig_universes << " universes: "
+            << duration_cast<duration<double, std::micro>>(time).count() << " us/frame" << std::endl;
+    }
+
+    monet::benchmarks::registration const registration("artnet", artnet);
+
+}
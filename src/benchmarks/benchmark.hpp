@@ -0,0 +1,63 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#ifndef MASTER_SERVER_BENCHMARK_HPP
+#define MASTER_SERVER_BENCHMARK_HPP
+
+#include <chrono>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+namespace monet::benchmarks {
+
+    /**
+     * @brief A benchmark registered with the benchmark executable.
+     */
+    struct benchmark {
+        std::string_view name;
+        std::function<void()> function;
+    };
+
+    /**
+     * @brief Get every registered benchmark.
+     */
+    inline std::vector<benchmark>& registry() {
+        static std::vector<benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    /**
+     * @brief Registers a benchmark on construction. Declare one at namespace scope per benchmark.
+     */
+    struct registration {
+        registration(std::string_view const a_name, std::function<void()> a_function) {
+            registry().push_back({ a_name, std::move(a_function) });
+        }
+    };
+
+    /**
+     * @brief Time a callable over a number of iterations.
+     *
+     * @param a_iterations The amount of times to invoke the callable, after one untimed warm-up invocation.
+     * @param a_function   The callable.
+     *
+     * @return The mean duration of one invocation.
+     */
+    template <typename t_function>
+    std::chrono::nanoseconds measure(size_t const a_iterations, t_function&& a_function) {
+        a_function();
+
+        auto const start = std::chrono::steady_clock::now();
+
+        for (size_t i = 0; i < a_iterations; ++i) {
+            a_function();
+        }
+
+        return (std::chrono::steady_clock::now() - start) / a_iterations;
+    }
+
+}
+
+#endif //MASTER_SERVER_BENCHMARK_HPP
@@ -0,0 +1,60 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <iostream>
+#include <thread>
+
+#include <monet.hpp>
+
+#include "benchmark.hpp"
+
+namespace {
+
+    /// Universes in the synthetic rig.
+    constexpr size_t rig_universes = 256;
+    /// RGB channels patched into each universe.
+    constexpr size_t rig_channels_per_universe = 170;
+
+    void channel_render() {
+        using namespace std::chrono;
+
+        monet::server server;
+
+        auto& config = server.channel_configuration("rgb");
+        config.add_attribute("rgb_color", monet::channel::attribute_definition("Color"));
+        config.address_mappings().emplace_back("rgb_color", 0, "red");
+        config.address_mappings().emplace_back("rgb_color", 0, "green");
+        config.address_mappings().emplace_back("rgb_color", 0, "blue");
+
+        for (size_t i = 0; i < rig_universes * rig_channels_per_universe; ++i) {
+            auto const universe = i / rig_channels_per_universe;
+            auto const address  = (i % rig_channels_per_universe) * 3;
+
+            server.create_channel(i + 1, config, universe * monet::dmx_data_channel_count + address + 1);
+        }
+
+        std::cout << rig_universes << " universes, " << server.channels().size() << " channels" << std::endl;
+
+        auto const max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+        nanoseconds single_thread_time{};
+
+        for (size_t threads = 1; threads <= max_threads; ++threads) {
+            server.set_render_threads(threads);
+
+            auto const time = monet::benchmarks::measure(50, [&] { server.render_all_channels(); });
+
+            if (threads == 1) {
+                single_thread_time = time;
+            }
+
+            std::cout
+                << threads << " thread(s): "
+                << duration_cast<duration<double, std::micro>>(time).count() << " us/frame, "
+                << static_cast<double>(single_thread_time.count()) / time.count() << "x" << std::endl;
+        }
+    }
+
+    monet::benchmarks::registration const registration("channel_render", channel_render);
+
+}
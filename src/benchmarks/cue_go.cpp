@@ -0,0 +1,72 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <iostream>
+
+#include <monet.hpp>
+
+#include "benchmark.hpp"
+
+namespace {
+
+    /// Dimmers in the synthetic rig, every one changing on every cue.
+    constexpr size_t rig_dimmers = 8192;
+    /// Cues in the stack, alternating between two looks.
+    constexpr size_t cue_count = 64;
+
+    void cue_go() {
+        using namespace std::chrono;
+
+        monet::server server;
+
+        auto& config = server.channel_configuration("dimmer");
+        config.add_attribute("intensity", monet::channel::attribute_definition("Intensity"));
+        config.address_mappings().emplace_back("intensity", 0);
+
+        auto& stack = server.create_cue_stack("Benchmark");
+
+        for (size_t i = 0; i < cue_count; ++i) {
+            stack.add_cue({ .name = std::to_string(i + 1), .fade_time = 3s });
+        }
+
+        for (size_t i = 0; i < rig_dimmers; ++i) {
+            auto& channel = server.create_channel(i + 1, config, i + 1);
+            auto* intensity = channel.attributes("intensity")[0].get();
+
+            for (size_t cue = 0; cue < cue_count; ++cue) {
+                stack.cues()[cue].values.push_back({
+                    &channel, intensity, monet::channel::attribute::attribute::base, cue % 2 ? uint16_t(0) : uint16_t(65535)
+                });
+            }
+        }
+
+        stack.compile();
+
+        // Measure from enqueuing GO until the frame carrying its first values has been published for output.
+        nanoseconds total{};
+        nanoseconds worst{};
+
+        for (size_t cue = 0; cue < cue_count; ++cue) {
+            auto const start = steady_clock::now();
+
+            server.enqueue_command({ .type = monet::command::command_type::go_cue, .target = 0 });
+            server.render_frame();
+            server.output_frame();
+
+            auto const latency = duration_cast<nanoseconds>(steady_clock::now() - start);
+
+            total += latency;
+            worst = std::max(worst, latency);
+        }
+
+        std::cout
+            << rig_dimmers << " channels per cue: GO latency "
+            << duration_cast<duration<double, std::micro>>(total / cue_count).count() << " us mean, "
+            << duration_cast<duration<double, std::micro>>(worst).count() << " us worst, frame time "
+            << duration_cast<duration<double, std::micro>>(server.scheduler().frame_time()).count() << " us" << std::endl;
+    }
+
+    monet::benchmarks::registration const registration("cue_go", cue_go);
+
+}
@@ -0,0 +1,57 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <iostream>
+#include <thread>
+
+#include <monet.hpp>
+
+#include "benchmark.hpp"
+
+namespace {
+
+    /// RGB channels in the synthetic rig, each driven by three effects.
+    constexpr size_t rig_channels = 16384;
+
+    void effect_engine() {
+        using namespace std::chrono;
+
+        monet::server server;
+
+        auto& config = server.channel_configuration("rgb");
+        config.add_attribute("rgb_color", monet::channel::attribute_definition("Color"));
+
+        auto& wave  = server.effects().create(monet::effect_waveform::sine, 0.5f, 0, 65535, 1.0f / rig_channels);
+        auto& chase = server.effects().create(monet::effect_waveform::square, 2.0f, 0, 65535, 1.0f / 16);
+        auto& noise = server.effects().create(monet::effect_waveform::noise, 1.0f, 20000, 65535);
+
+        for (size_t i = 0; i < rig_channels; ++i) {
+            auto& channel = server.create_channel(i + 1, config);
+            auto& color = *channel.attributes("rgb_color")[0];
+
+            wave.add_member(channel, color, monet::channel::attribute::rgb_color::red);
+            chase.add_member(channel, color, monet::channel::attribute::rgb_color::green);
+            noise.add_member(channel, color, monet::channel::attribute::rgb_color::blue);
+        }
+
+        auto const max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+        for (size_t threads = 1; threads <= max_threads; ++threads) {
+            server.set_render_threads(threads);
+
+            auto const time = monet::benchmarks::measure(100, [&] { server.render_frame(); });
+
+            std::cout
+                << threads << " thread(s): "
+                << duration_cast<duration<double, std::micro>>(time).count() << " us/frame, effects "
+                << duration_cast<duration<double, std::micro>>(server.effect_time()).count() << " us (wave "
+                << duration_cast<duration<double, std::micro>>(wave.cost()).count() << " us, chase "
+                << duration_cast<duration<double, std::micro>>(chase.cost()).count() << " us, noise "
+                << duration_cast<duration<double, std::micro>>(noise.cost()).count() << " us)" << std::endl;
+        }
+    }
+
+    monet::benchmarks::registration const registration("effect_engine", effect_engine);
+
+}
@@ -0,0 +1,44 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <iostream>
+
+#include <monet.hpp>
+
+#include "benchmark.hpp"
+
+namespace {
+
+    /// Dimmers in the synthetic rig, all fading at once.
+    constexpr size_t rig_dimmers = 4096;
+
+    void fade_engine() {
+        using namespace std::chrono;
+
+        monet::server server;
+
+        auto& config = server.channel_configuration("dimmer");
+        config.add_attribute("intensity", monet::channel::attribute_definition("Intensity"));
+        config.address_mappings().emplace_back("intensity", 0);
+
+        for (size_t i = 0; i < rig_dimmers; ++i) {
+            auto& channel = server.create_channel(i + 1, config, i + 1);
+            channel.attributes("intensity")[0]->set_value(monet::channel::attribute::attribute::base, 255);
+        }
+
+        // A whole-house "goodnight": every dimmer fades out over a long time, so no fade finishes while measuring.
+        for (auto& [channel_number, channel] : server.channels()) {
+            server.fades().start(*channel, *channel->attributes("intensity")[0], monet::channel::attribute::attribute::base, 0, 1h);
+        }
+
+        auto const time = monet::benchmarks::measure(200, [&] { server.render_frame(); });
+
+        std::cout
+            << server.fades().size() << " fades: "
+            << duration_cast<duration<double, std::micro>>(time).count() << " us/frame" << std::endl;
+    }
+
+    monet::benchmarks::registration const registration("fade_engine", fade_engine);
+
+}
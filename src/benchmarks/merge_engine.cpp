@@ -0,0 +1,56 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <iostream>
+
+#include <monet.hpp>
+
+#include "benchmark.hpp"
+
+namespace {
+
+    /// Universes in the synthetic rig, every one written by every source each frame.
+    constexpr size_t rig_universes = 256;
+    /// Sources merged on top of the rendered output.
+    constexpr size_t source_count = 4;
+
+    void merge_engine() {
+        using namespace std::chrono;
+
+        monet::address::merge_engine engine;
+        std::vector<monet::address::universe> rendered(rig_universes);
+        std::vector<monet::address::merge_source*> sources;
+        std::array<uint8_t, monet::dmx_data_channel_count> values{};
+
+        for (size_t i = 0; i < source_count; ++i) {
+            sources.push_back(&engine.create_source("Source " + std::to_string(i)));
+        }
+
+        uint8_t frame = 0;
+
+        // Worst case: every source changes every universe every frame, so every universe is re-merged.
+        auto const time = monet::benchmarks::measure(200, [&] {
+            ++frame;
+
+            for (size_t source = 0; source < source_count; ++source) {
+                values.fill(static_cast<uint8_t>(frame + source * 16));
+
+                for (size_t universe = 0; universe < rig_universes; ++universe) {
+                    sources[source]->set_addresses(universe + 1, 1, values);
+                }
+            }
+
+            for (size_t universe = 0; universe < rig_universes; ++universe) {
+                static_cast<void>(engine.merge(universe + 1, rendered[universe]));
+            }
+        });
+
+        std::cout
+            << rig_universes << " universes, " << source_count << " sources: "
+            << duration_cast<duration<double, std::micro>>(time).count() << " us/frame" << std::endl;
+    }
+
+    monet::benchmarks::registration const registration("merge_engine", merge_engine);
+
+}
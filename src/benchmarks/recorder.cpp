@@ -0,0 +1,56 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <filesystem>
+#include <iostream>
+
+#include <monet.hpp>
+
+#include "benchmark.hpp"
+
+namespace {
+
+    /// Universes recorded every frame.
+    constexpr size_t rig_universes = 64;
+    /// One minute at 44Hz. An hour is sixty times the size.
+    constexpr size_t recorded_frames = 44 * 60;
+
+    void recorder() {
+        using namespace std::chrono;
+
+        auto const path = std::filesystem::temp_directory_path() / "monet_recorder_benchmark.rec";
+
+        monet::server server;
+        monet::sink::recorder sink(path);
+        std::vector<monet::sink::frame_universe> frame;
+
+        for (size_t universe = 1; universe <= rig_universes; ++universe) {
+            auto& output = server.get_universe(universe);
+            output.set_address(monet::dmx_data_channel_count, 0);
+            frame.push_back({ universe, &output });
+        }
+
+        if (!sink.initialize(server)) {
+            std::cout << "Failed to create the recording file" << std::endl;
+            return;
+        }
+
+        // Every universe is recorded every frame, as if the whole rig were changing.
+        auto const time = monet::benchmarks::measure(recorded_frames, [&] {
+            sink.send_frame(frame);
+        });
+
+        sink.deinitialize();
+
+        std::cout
+            << rig_universes << " universes: "
+            << duration_cast<duration<double, std::micro>>(time).count() << " us/frame, "
+            << std::filesystem::file_size(path) * 60 / (1024 * 1024) << " MiB/hour" << std::endl;
+
+        std::filesystem::remove(path);
+    }
+
+    monet::benchmarks::registration const registration("recorder", recorder);
+
+}
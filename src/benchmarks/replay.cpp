@@ -0,0 +1,114 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <filesystem>
+#include <iostream>
+
+#include <monet.hpp>
+
+#include "benchmark.hpp"
+
+namespace {
+
+    /// Universes in the recorded rig.
+    constexpr size_t rig_universes = 32;
+    /// An hour at 44Hz.
+    constexpr size_t recorded_frames = 44 * 60 * 60;
+
+    void replay() {
+        using namespace std::chrono;
+
+        auto const recording_path = std::filesystem::temp_directory_path() / "monet_replay_benchmark.rec";
+        auto const show_path = std::filesystem::temp_directory_path() / "monet_replay_benchmark.show";
+
+        monet::server server;
+        std::vector<monet::sink::frame_universe> rig;
+
+        for (size_t universe = 1; universe <= rig_universes; ++universe) {
+            auto& output = server.get_universe(universe);
+            output.set_address(monet::dmx_data_channel_count, 0);
+            rig.push_back({ universe, &output });
+        }
+
+        // A mostly static show: a chase steps through the rig one universe per frame, as the sink outputs would only
+        // hand the recorder the universes that changed.
+        {
+            monet::sink::recorder recorder(recording_path);
+
+            if (!recorder.initialize(server)) {
+                std::cout << "Failed to create the recording file" << std::endl;
+                return;
+            }
+
+            recorder.send_frame(rig);
+
+            for (size_t frame = 1; frame < recorded_frames; ++frame) {
+                auto const& step = rig[frame % rig_universes];
+                server.get_universe(step.number).set_address(1 + frame / rig_universes % 64, static_cast<uint8_t>(frame / rig_universes));
+                recorder.send_frame(std::span(&step, 1));
+            }
+        }
+
+        monet::recording::reader recording;
+        recording.open(recording_path);
+
+        auto const encode_start = steady_clock::now();
+
+        if (!monet::recording::encode_show_file(recording, show_path)) {
+            std::cout << "Failed to write the show file" << std::endl;
+            return;
+        }
+
+        auto const encode_time = steady_clock::now() - encode_start;
+
+        // Decode the whole show and send every frame through sACN.
+        monet::recording::show_player player;
+        monet::sink::sacn sink("Replay benchmark");
+        std::vector<monet::sink::frame_universe> frame;
+
+        auto const opened = player.open(show_path) && sink.initialize(server);
+        auto const replay_start = steady_clock::now();
+
+        while (opened && player.next_frame()) {
+            frame.clear();
+
+            for (auto const universe_number : player.changed()) {
+                frame.push_back({ universe_number, player.universes().find(universe_number) });
+            }
+
+            sink.send_frame(frame);
+        }
+
+        auto const replay_time = steady_clock::now() - replay_start;
+
+        sink.deinitialize();
+
+        auto const recording_size = std::filesystem::file_size(recording_path);
+        auto const show_size = std::filesystem::file_size(show_path);
+
+        std::cout
+            << recorded_frames << " frames: "
+            << recording_size / (1024 * 1024) << " MiB recorded, "
+            << show_size / 1024 << " KiB show file ("
+            << recording_size / show_size << "x), encoded in "
+            << duration_cast<milliseconds>(encode_time).count() << " ms" << std::endl;
+
+        if (opened) {
+            std::cout
+                << "Replayed through sACN in "
+                << duration_cast<milliseconds>(replay_time).count() << " ms ("
+                << duration_cast<duration<double, std::micro>>(replay_time / player.header().frame_count).count() << " us/frame)" << std::endl;
+        } else {
+            std::cout << "Failed to open the show file or the sACN socket" << std::endl;
+        }
+
+        recording.close();
+        player.close();
+        std::filesystem::remove(recording_path);
+        std::filesystem::remove(show_path);
+    }
+
+    monet::benchmarks::registration const registration("replay", replay);
+
+}
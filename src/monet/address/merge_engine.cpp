@@ -0,0 +1,389 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <algorithm>
+#include <cstring>
+
+#include <monet.hpp>
+
+namespace monet::address {
+
+    namespace {
+
+        using buffer = std::array<uint8_t, dmx_data_channel_count>;
+        using stamp_buffer = std::array<uint32_t, dmx_data_channel_count>;
+
+        /// Working buffers for one priority while merging.
+        struct group_buffers {
+            /// HTP result of the priority.
+            buffer htp;
+            /// 0xFF for each address controlled by any source of the priority.
+            buffer mask;
+            /// LTP result of the priority.
+            buffer ltp;
+            /// Time stamp of each LTP result.
+            stamp_buffer ltp_stamps;
+
+            void clear() noexcept {
+                htp.fill(0);
+                mask.fill(0);
+                ltp.fill(0);
+                ltp_stamps.fill(0);
+            }
+        };
+
+        /// Mask of a source controlling every address.
+        constexpr auto full_mask = [] {
+            buffer mask{};
+            mask.fill(0xFF);
+            return mask;
+        }();
+
+        // The kernels below are written as plain loops over whole buffers with no branches, so each compiles to
+        // packed byte (or dword) instructions.
+
+        /// Fold one source into the HTP result of its priority.
+        void fold_htp(buffer& a_result, buffer& a_result_mask, uint8_t const* const a_values, uint8_t const* const a_mask) noexcept {
+            for (size_t i = 0; i < dmx_data_channel_count; ++i) {
+                a_result[i] = std::max<uint8_t>(a_result[i], a_values[i] & a_mask[i]);
+                a_result_mask[i] |= a_mask[i];
+            }
+        }
+
+        /// Fold one source into the LTP result of its priority. Later writes win ties, as they were folded last.
+        void fold_ltp(group_buffers& a_group, uint8_t const* const a_values, uint8_t const* const a_mask, uint32_t const* const a_stamps) noexcept {
+            for (size_t i = 0; i < dmx_data_channel_count; ++i) {
+                auto const take = a_mask[i] != 0 && a_stamps[i] >= a_group.ltp_stamps[i];
+
+                a_group.ltp[i]        = take ? a_values[i] : a_group.ltp[i];
+                a_group.ltp_stamps[i] = take ? a_stamps[i] : a_group.ltp_stamps[i];
+            }
+        }
+
+        /// Pick the HTP or LTP result of a priority for each address.
+        void select_ltp(buffer& a_result, buffer const& a_ltp, buffer const& a_ltp_mask) noexcept {
+            for (size_t i = 0; i < dmx_data_channel_count; ++i) {
+                a_result[i] = (a_result[i] & ~a_ltp_mask[i]) | (a_ltp[i] & a_ltp_mask[i]);
+            }
+        }
+
+        /// Write the result of a priority to the addresses not yet controlled by a higher priority.
+        void blend_below(buffer& a_output, buffer& a_covered, buffer const& a_result, buffer const& a_mask) noexcept {
+            for (size_t i = 0; i < dmx_data_channel_count; ++i) {
+                auto const take = static_cast<uint8_t>(a_mask[i] & ~a_covered[i]);
+
+                a_output[i]   = (a_output[i] & ~take) | (a_result[i] & take);
+                a_covered[i] |= a_mask[i];
+            }
+        }
+
+    }
+
+    merge_source::layer& merge_source::fetch_layer(size_t const a_universe) {
+        auto& layer = m_layers[a_universe];
+
+        if (!layer) {
+            layer = std::make_unique<merge_source::layer>();
+        }
+
+        return *layer;
+    }
+
+    void merge_source::set_priority(uint8_t const a_priority) {
+        m_priority.store(a_priority, std::memory_order_relaxed);
+
+        std::scoped_lock const lock(m_mutex);
+
+        for (auto const& [universe_number, layer] : m_layers) {
+            m_engine.mark_pending(universe_number);
+        }
+    }
+
+    uint8_t merge_source::priority(size_t const a_universe) const {
+        std::scoped_lock const lock(m_mutex);
+        auto const it = m_layers.find(a_universe);
+
+        return it != m_layers.end() && it->second->priority ? *it->second->priority : priority();
+    }
+
+    void merge_source::set_priority(size_t const a_universe, uint8_t const a_priority) {
+        if (!universe_table::valid(a_universe)) [[unlikely]] {
+            return;
+        }
+
+        {
+            std::scoped_lock const lock(m_mutex);
+            auto& layer = fetch_layer(a_universe);
+
+            if (layer.priority == a_priority) {
+                return;
+            }
+
+            layer.priority = a_priority;
+        }
+
+        m_engine.mark_pending(a_universe);
+    }
+
+    void merge_source::set_address(size_t const a_universe, size_t const a_address, uint8_t const a_value) {
+        set_addresses(a_universe, a_address, std::span(&a_value, 1));
+    }
+
+    void merge_source::set_addresses(size_t const a_universe, size_t const a_address, std::span<uint8_t const> const a_values) {
+        if (!universe_table::valid(a_universe) || a_address == 0 || a_address > dmx_data_channel_count) [[unlikely]] {
+            return;
+        }
+
+        auto const first = a_address - 1;
+        auto const count = std::min(a_values.size(), dmx_data_channel_count - first);
+        auto const stamp = m_engine.next_stamp();
+
+        {
+            std::scoped_lock const lock(m_mutex);
+            auto& layer = fetch_layer(a_universe);
+
+            std::memcpy(layer.values.data() + first, a_values.data(), count);
+            std::fill_n(layer.mask.data() + first, count, 0xFF);
+            std::fill_n(layer.stamps.data() + first, count, stamp);
+            layer.address_count = std::max(layer.address_count, a_address + count);
+        }
+
+        m_engine.mark_pending(a_universe);
+    }
+
+    void merge_source::release(size_t const a_universe, size_t const a_address, size_t const a_count) {
+        if (a_address == 0 || a_address > dmx_data_channel_count) [[unlikely]] {
+            return;
+        }
+
+        auto const first = a_address - 1;
+        auto const count = std::min(a_count, dmx_data_channel_count - first);
+
+        {
+            std::scoped_lock const lock(m_mutex);
+            auto const it = m_layers.find(a_universe);
+
+            if (it == m_layers.end()) {
+                return;
+            }
+
+            std::fill_n(it->second->mask.data() + first, count, 0);
+        }
+
+        m_engine.mark_pending(a_universe);
+    }
+
+    void merge_source::release(size_t const a_universe) {
+        {
+            std::scoped_lock const lock(m_mutex);
+
+            if (m_layers.erase(a_universe) == 0) {
+                return;
+            }
+        }
+
+        m_engine.mark_pending(a_universe);
+    }
+
+    void merge_source::release_all() {
+        std::scoped_lock const lock(m_mutex);
+
+        for (auto const& [universe_number, layer] : m_layers) {
+            m_engine.mark_pending(universe_number);
+        }
+
+        m_layers.clear();
+    }
+
+    std::optional<uint8_t> merge_source::address(size_t const a_universe, size_t const a_address) const {
+        if (a_address == 0 || a_address > dmx_data_channel_count) [[unlikely]] {
+            return std::nullopt;
+        }
+
+        std::scoped_lock const lock(m_mutex);
+        auto const it = m_layers.find(a_universe);
+
+        if (it == m_layers.end() || it->second->mask[a_address - 1] == 0) {
+            return std::nullopt;
+        }
+
+        return it->second->values[a_address - 1];
+    }
+
+    merge_engine::merge_state& merge_engine::fetch_state(size_t const a_universe) {
+        auto& index = m_state_indices[a_universe];
+
+        if (index == 0) {
+            m_states.emplace_back(std::make_unique<merge_state>());
+            index = static_cast<uint16_t>(m_states.size());
+        }
+
+        return *m_states[index - 1];
+    }
+
+    merge_source& merge_engine::create_source(std::string a_name, uint8_t const a_priority) {
+        return *m_sources.emplace_back(std::make_unique<merge_source>(*this, std::move(a_name), a_priority));
+    }
+
+    void merge_engine::destroy_source(merge_source const& a_source) {
+        auto const it = std::ranges::find_if(m_sources, [&] (auto const& a_other) {
+            return a_other.get() == &a_source;
+        });
+
+        if (it == m_sources.end()) {
+            return;
+        }
+
+        (*it)->release_all();
+        m_sources.erase(it);
+    }
+
+    void merge_engine::set_render_priority(uint8_t const a_priority) noexcept {
+        m_render_priority.store(a_priority, std::memory_order_relaxed);
+
+        for (size_t universe_number = min_universe_number; universe_number <= max_universe_number; ++universe_number) {
+            if (m_state_indices[universe_number] != 0) {
+                mark_pending(universe_number);
+            }
+        }
+    }
+
+    void merge_engine::set_mode(size_t const a_universe, size_t const a_address, size_t const a_count, merge_mode const a_mode) {
+        if (!universe_table::valid(a_universe) || a_address == 0 || a_address > dmx_data_channel_count) [[unlikely]] {
+            return;
+        }
+
+        auto& state = fetch_state(a_universe);
+        auto const first = a_address - 1;
+        auto const count = std::min(a_count, dmx_data_channel_count - first);
+
+        std::fill_n(state.ltp_mask.data() + first, count, a_mode == merge_mode::ltp ? 0xFF : 0);
+        state.has_ltp = std::ranges::any_of(state.ltp_mask, [] (uint8_t const a_mask) { return a_mask != 0; });
+
+        mark_pending(a_universe);
+    }
+
+    merge_mode merge_engine::mode(size_t const a_universe, size_t const a_address) const noexcept {
+        if (!universe_table::valid(a_universe) || a_address == 0 || a_address > dmx_data_channel_count) [[unlikely]] {
+            return merge_mode::htp;
+        }
+
+        auto const index = m_state_indices[a_universe];
+
+        return index != 0 && m_states[index - 1]->ltp_mask[a_address - 1] ? merge_mode::ltp : merge_mode::htp;
+    }
+
+    universe const* merge_engine::merge(size_t const a_universe, universe const& a_rendered) {
+        if (!universe_table::valid(a_universe)) [[unlikely]] {
+            return nullptr;
+        }
+
+        auto& pending = m_pending[a_universe];
+
+        // Universes no source has touched pass straight through.
+        if (m_state_indices[a_universe] == 0 && !pending.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+
+        auto& state = fetch_state(a_universe);
+        auto const rendered_changed = a_rendered.generation() != state.rendered_generation;
+
+        if (!pending.exchange(false, std::memory_order_acq_rel) && !rendered_changed) {
+            return &state.output;
+        }
+
+        if (state.rendered_generation == static_cast<uint64_t>(-1)) {
+            // Start from the rendered universe, so the output only gets a new generation if the merge changes it.
+            state.output = a_rendered;
+        } else if (rendered_changed && state.has_ltp) {
+            // Rendered addresses count as written when they change.
+            auto const [first, last] = a_rendered.dirty_range();
+            auto const stamp = next_stamp();
+
+            for (auto address = std::max<size_t>(first, 1); address < last; ++address) {
+                state.render_stamps[address - 1] = stamp;
+            }
+        }
+
+        state.rendered_generation = a_rendered.generation();
+        state.output.clear_dirty();
+
+        m_order.clear();
+
+        // Sources that never wrote to the universe take no part in it.
+        for (auto const& source : m_sources) {
+            std::scoped_lock const lock(source->m_mutex);
+            auto const it = source->m_layers.find(a_universe);
+
+            if (it != source->m_layers.end()) {
+                m_order.push_back({ source.get(), it->second->priority.value_or(source->priority()) });
+            }
+        }
+
+        std::ranges::stable_sort(m_order, std::greater(), &ordered_source::priority);
+
+        group_buffers group;
+        buffer output{};
+        buffer covered{};
+        auto address_count = a_rendered.address_count();
+        auto const render_priority = m_render_priority.load(std::memory_order_relaxed);
+        auto rendered_merged = false;
+        auto source = m_order.begin();
+
+        // Walk the priorities from the top. The rendered universe controls every address, so nothing below it can
+        // show through and the walk stops there.
+        while (!rendered_merged) {
+            auto const priority = source != m_order.end() ? std::max(source->priority, render_priority) : render_priority;
+
+            group.clear();
+
+            for (; source != m_order.end() && source->priority == priority; ++source) {
+                std::scoped_lock const lock(source->source->m_mutex);
+                auto const it = source->source->m_layers.find(a_universe);
+
+                // Released since the sources were sorted.
+                if (it == source->source->m_layers.end()) {
+                    continue;
+                }
+
+                auto const& layer = *it->second;
+
+                fold_htp(group.htp, group.mask, layer.values.data(), layer.mask.data());
+
+                if (state.has_ltp) {
+                    fold_ltp(group, layer.values.data(), layer.mask.data(), layer.stamps.data());
+                }
+
+                address_count = std::max(address_count, layer.address_count);
+            }
+
+            if (priority == render_priority) {
+                fold_htp(group.htp, group.mask, a_rendered.buffer() + 1, full_mask.data());
+
+                if (state.has_ltp) {
+                    fold_ltp(group, a_rendered.buffer() + 1, full_mask.data(), state.render_stamps.data());
+                }
+
+                rendered_merged = true;
+            }
+
+            if (state.has_ltp) {
+                select_ltp(group.htp, group.ltp, state.ltp_mask);
+            }
+
+            blend_below(output, covered, group.htp, group.mask);
+        }
+
+        // Only touch the output if the result changed, so unchanged universes keep their generation.
+        if (std::memcmp(state.output.buffer() + 1, output.data(), output.size()) != 0) {
+            state.output.set_addresses(1, output);
+        }
+
+        state.output.set_address(0, a_rendered.address(0));
+        state.output.set_address_count(address_count);
+
+        return &state.output;
+    }
+
+}
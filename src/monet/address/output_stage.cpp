@@ -0,0 +1,223 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+#include <monet.hpp>
+
+namespace monet::address {
+
+    namespace {
+
+        /// Parse a boolean property, leaving the value alone if it is not recognized.
+        void parse_property(std::string_view const a_property, bool& a_value) noexcept {
+            if (a_property == "true" || a_property == "1") {
+                a_value = true;
+            } else if (a_property == "false" || a_property == "0") {
+                a_value = false;
+            }
+        }
+
+        /// Parse a numeric property, leaving the value alone if it is malformed.
+        template <typename t_value>
+        void parse_property(std::string_view const a_property, t_value& a_value) noexcept {
+            t_value value{};
+
+            if (auto const [end, error] = std::from_chars(a_property.data(), a_property.data() + a_property.size(), value);
+                error == std::errc() && end == a_property.data() + a_property.size()) {
+                a_value = value;
+            }
+        }
+
+    }
+
+    output_transform output_transform::from_properties(channel::attribute_definition const& a_definition, bool const a_mastered) noexcept {
+        output_transform transform{ .mastered = a_mastered };
+
+        if (auto const curve = a_definition.property("curve"); curve == "square") {
+            transform.curve = dimmer_curve::square;
+        } else if (curve == "inverse_square") {
+            transform.curve = dimmer_curve::inverse_square;
+        } else if (curve == "s") {
+            transform.curve = dimmer_curve::s_curve;
+        }
+
+        auto gamma = transform.gamma;
+        parse_property(a_definition.property("gamma"), gamma);
+
+        if (gamma > 0.0f) {
+            transform.gamma = gamma;
+        }
+
+        parse_property(a_definition.property("master"), transform.mastered);
+        parse_property(a_definition.property("min"), transform.min);
+        parse_property(a_definition.property("max"), transform.max);
+        parse_property(a_definition.property("invert"), transform.invert);
+
+        return transform;
+    }
+
+    void output_stage::build_table(output_transform const& a_transform, uint8_t const a_grand_master, std::span<uint8_t, 256> const a_table) noexcept {
+        auto const master = a_transform.mastered ? a_grand_master / 255.0f : 1.0f;
+
+        for (size_t input = 0; input < a_table.size(); ++input) {
+            auto level = static_cast<float>(input) / 255.0f;
+
+            switch (a_transform.curve) {
+                case dimmer_curve::linear:
+                    break;
+                case dimmer_curve::square:
+                    level *= level;
+                    break;
+                case dimmer_curve::inverse_square:
+                    level = std::sqrt(level);
+                    break;
+                case dimmer_curve::s_curve:
+                    level = level * level * (3.0f - 2.0f * level);
+                    break;
+            }
+
+            if (a_transform.gamma != 1.0f) {
+                level = std::pow(level, a_transform.gamma);
+            }
+
+            // Limits apply before the grand master, so a grand master of 0 blacks out fixtures with a minimum too.
+            auto const limited = std::min<long>(std::max<long>(std::lround(level * 255.0f), a_transform.min), a_transform.max);
+            auto const value = std::lround(static_cast<float>(limited) * master);
+
+            a_table[input] = static_cast<uint8_t>(a_transform.invert ? 255 - value : value);
+        }
+    }
+
+    void output_stage::build_tables() {
+        m_tables.resize(m_transforms.size() * 256);
+        m_identity_tables.resize(m_transforms.size());
+
+        for (size_t index = 0; index < m_transforms.size(); ++index) {
+            auto const table = std::span<uint8_t, 256>(m_tables.data() + index * 256, 256);
+
+            build_table(m_transforms[index], m_grand_master, table);
+
+            m_identity_tables[index] = true;
+
+            for (size_t input = 0; input < table.size(); ++input) {
+                m_identity_tables[index] = m_identity_tables[index] && table[input] == input;
+            }
+        }
+
+        ++m_revision;
+    }
+
+    void output_stage::set_transform(size_t const a_universe, size_t const a_address, output_transform const& a_transform) {
+        if (!universe_table::valid(a_universe) || a_address == 0 || a_address > dmx_data_channel_count) [[unlikely]] {
+            return;
+        }
+
+        auto& state_index = m_state_indices[a_universe];
+
+        // Universes are only ever transformed once an address has a transform.
+        if (state_index == 0) {
+            if (a_transform.identity()) {
+                return;
+            }
+
+            m_states.emplace_back(std::make_unique<state>());
+            state_index = static_cast<uint16_t>(m_states.size());
+        }
+
+        auto transform_index = static_cast<size_t>(std::ranges::find(m_transforms, a_transform) - m_transforms.begin());
+
+        if (transform_index == m_transforms.size()) {
+            m_transforms.push_back(a_transform);
+            build_tables();
+        }
+
+        m_states[state_index - 1]->transforms[a_address - 1] = static_cast<uint16_t>(transform_index);
+        ++m_revision;
+    }
+
+    output_transform const& output_stage::transform(size_t const a_universe, size_t const a_address) const noexcept {
+        if (!universe_table::valid(a_universe) || a_address == 0 || a_address > dmx_data_channel_count) [[unlikely]] {
+            return m_transforms.front();
+        }
+
+        auto const state_index = m_state_indices[a_universe];
+
+        return state_index == 0 ? m_transforms.front() : m_transforms[m_states[state_index - 1]->transforms[a_address - 1]];
+    }
+
+    void output_stage::clear() noexcept {
+        // States are kept, so universes once transformed keep being output from their own copy.
+        for (auto const& state : m_states) {
+            state->transforms.fill(0);
+        }
+
+        ++m_revision;
+    }
+
+    void output_stage::set_grand_master(uint8_t const a_level) {
+        if (m_grand_master != a_level) {
+            m_grand_master = a_level;
+            build_tables();
+        }
+    }
+
+    universe const* output_stage::apply(size_t const a_universe, universe const& a_source) {
+        if (!universe_table::valid(a_universe) || m_state_indices[a_universe] == 0) {
+            return nullptr;
+        }
+
+        auto& state = *m_states[m_state_indices[a_universe] - 1];
+
+        if (state.source == &a_source && state.source_generation == a_source.generation() && state.revision == m_revision) {
+            return &state.output;
+        }
+
+        if (!state.source) {
+            // Start from the source, so the output only gets a new generation if the transform changes it.
+            state.output = a_source;
+        }
+
+        if (state.revision != m_revision) {
+            state.mask.fill(0);
+
+            for (size_t address = 0; address < dmx_data_channel_count; ++address) {
+                if (!m_identity_tables[state.transforms[address]]) {
+                    state.mask[address / 64] |= uint64_t(1) << (address % 64);
+                }
+            }
+        }
+
+        state.source = &a_source;
+        state.source_generation = a_source.generation();
+        state.revision = m_revision;
+        state.output.clear_dirty();
+
+        std::array<uint8_t, dmx_data_channel_count> values;
+        std::memcpy(values.data(), a_source.buffer() + 1, values.size());
+
+        // Look up the transformed addresses only, a 64 address block at a time.
+        for (size_t block = 0; block < state.mask.size(); ++block) {
+            for (auto bits = state.mask[block]; bits != 0; bits &= bits - 1) {
+                auto const address = block * 64 + std::countr_zero(bits);
+
+                values[address] = m_tables[state.transforms[address] * 256 + values[address]];
+            }
+        }
+
+        // Only touch the output if the result changed, so unchanged universes keep their generation.
+        if (std::memcmp(state.output.buffer() + 1, values.data(), values.size()) != 0) {
+            state.output.set_addresses(1, values);
+        }
+
+        state.output.set_address(0, a_source.address(0));
+        state.output.set_address_count(a_source.address_count());
+
+        return &state.output;
+    }
+
+}
@@ -0,0 +1,32 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <stdexcept>
+
+#include <monet.hpp>
+
+namespace monet::address {
+
+    universe& universe_table::create(size_t const a_universe) {
+        if (!valid(a_universe)) [[unlikely]] {
+            throw std::out_of_range("universe number out of range");
+        }
+
+        if (auto const slot_id = m_slots[a_universe]; slot_id != 0) {
+            return slot(slot_id - 1);
+        }
+
+        auto const slot_index = m_slot_universes.size();
+
+        if (slot_index % chunk_size == 0) {
+            m_chunks.emplace_back(std::make_unique<chunk>());
+        }
+
+        m_slot_universes.push_back(static_cast<uint16_t>(a_universe));
+        m_slots[a_universe] = static_cast<uint16_t>(slot_index + 1);
+
+        return slot(slot_index);
+    }
+
+}
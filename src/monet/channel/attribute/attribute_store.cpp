@@ -0,0 +1,68 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+
+namespace monet::channel::attribute {
+
+    attribute_pool::allocation attribute_pool::allocate() {
+        std::lock_guard lock(m_mutex);
+
+        if (!m_free_slots.empty()) {
+            auto const slot = m_free_slots.back();
+            m_free_slots.pop_back();
+
+            return { slot, values(slot) };
+        }
+
+        auto const slot = m_size.load(std::memory_order_relaxed);
+
+        // Add a chunk rather than grow one, so the values of other slots never move.
+        if (slot % attribute_pool_chunk_slots == 0) {
+            m_chunks.push_back(std::make_unique<uint8_t[]>(attribute_pool_chunk_slots * m_stride));
+        }
+
+        m_size.store(slot + 1, std::memory_order_release);
+
+        return { slot, values(slot) };
+    }
+
+    void attribute_pool::release(size_t const a_slot) {
+        std::lock_guard lock(m_mutex);
+
+        std::fill_n(values(a_slot), m_stride, 0);
+        m_free_slots.push_back(a_slot);
+    }
+
+    std::span<uint8_t const> attribute_pool::chunk(size_t const a_chunk) const noexcept {
+        auto const slots = std::min(size() - a_chunk * attribute_pool_chunk_slots, attribute_pool_chunk_slots);
+
+        return { m_chunks[a_chunk].get(), slots * m_stride };
+    }
+
+    attribute_pool& attribute_store::pool(std::string_view const a_type, size_t const a_stride) {
+        std::lock_guard lock(m_mutex);
+
+        auto& pool = m_pools[a_type];
+
+        if (!pool) {
+            pool = std::make_unique<attribute_pool>(a_stride);
+        }
+
+        return *pool;
+    }
+
+    attribute_pool* attribute_store::find_pool(std::string_view const a_type) noexcept {
+        std::lock_guard lock(m_mutex);
+
+        auto const it = m_pools.find(a_type);
+        return it == m_pools.cend() ? nullptr : it->second.get();
+    }
+
+    attribute_store& attribute_store::default_store() noexcept {
+        static attribute_store store;
+        return store;
+    }
+
+}
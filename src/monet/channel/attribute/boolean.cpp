@@ -17,14 +17,16 @@ namespace monet::channel::attribute {
     }
 
     uint8_t boolean::value(attribute_channel const a_channel) const noexcept {
+        bool const state = state_value();
+
         switch (a_channel) {
             case binary:
-                return m_state;
+                return state;
             case inverse:
-                return !m_state * 255;
+                return !state * 255;
             case base:
             default:
-                return m_state * 255;
+                return state * 255;
         }
     }
 
@@ -32,13 +34,13 @@ namespace monet::channel::attribute {
         switch (a_channel) {
             case binary:
                 // Translate to 0-255.
-                m_state = a_value > 0;
+                set_intensity_value(a_value > 0);
                 break;
             case inverse:
-                m_state = a_value < boolean_threshold;
+                set_intensity_value(a_value < boolean_threshold);
             case base:
             default:
-                m_state = a_value >= boolean_threshold;
+                set_intensity_value(a_value >= boolean_threshold);
         }
     }
 
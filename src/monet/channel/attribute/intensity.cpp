@@ -8,8 +8,9 @@ namespace monet::channel::attribute {
 
     std::span<std::string_view const> intensity::available_channels() const noexcept {
         static std::vector<std::string_view> const m_available_channels = {
-            "base",  // 0-255
-            "normal" // 0-100
+            "base",     // 0-255
+            "normal",   // 0-100
+            "base_fine" // Least significant byte of 0-65535
         };
 
         return m_available_channels;
@@ -18,23 +19,56 @@ namespace monet::channel::attribute {
     uint8_t intensity::value(attribute_channel const a_channel) const noexcept {
         switch (a_channel) {
             case normal:
-                // Translate to 0-100.
-                return static_cast<uint8_t>(std::ceil((static_cast<double>(m_intensity_value) / 255.0) * 100.0));
+                // Translate to 0-100, rounding up.
+                return static_cast<uint8_t>((intensity_value_16() * 100u + 65534u) / 65535u);
+            case base_fine:
+                return values()[1];
             case base:
             default:
-                return m_intensity_value;
+                return intensity_value();
         }
     }
 
     void intensity::set_value(attribute_channel const a_channel, uint8_t const a_value) noexcept {
         switch (a_channel) {
             case normal:
-                // Translate to 0-255.
-                m_intensity_value = static_cast<uint8_t>((static_cast<double>(a_value) / 100.0) * 255.0);
+                // Translate to 0-65535.
+                set_intensity_value_16(static_cast<uint16_t>(std::min<uint32_t>(a_value, 100) * 65535u / 100u));
                 break;
+            case base_fine:
+                values()[1] = a_value;
+                break;
+            case base:
+            default:
+                set_intensity_value(a_value);
+        }
+    }
+
+    uint16_t intensity::value_16(attribute_channel const a_channel) const noexcept {
+        if (a_channel == base) {
+            return intensity_value_16();
+        }
+
+        return attribute::value_16(a_channel);
+    }
+
+    void intensity::set_value_16(attribute_channel const a_channel, uint16_t const a_value) noexcept {
+        if (a_channel == base) {
+            set_intensity_value_16(a_value);
+            return;
+        }
+
+        attribute::set_value_16(a_channel, a_value);
+    }
+
+    std::optional<size_t> intensity::value_offset(attribute_channel const a_channel) const noexcept {
+        switch (a_channel) {
             case base:
+                return 0;
+            case base_fine:
+                return 1;
             default:
-                m_intensity_value = a_value;
+                return std::nullopt;
         }
     }
 
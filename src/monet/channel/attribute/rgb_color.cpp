@@ -11,7 +11,10 @@ namespace monet::channel::attribute {
             "base", // Base channel not used in rgb_color but must be defined regardless.
             "red",
             "green",
-            "blue"
+            "blue",
+            "red_fine",
+            "green_fine",
+            "blue_fine"
         };
 
         return m_available_channels;
@@ -20,11 +23,15 @@ namespace monet::channel::attribute {
     uint8_t rgb_color::value(attribute_channel const a_channel) const noexcept {
         switch (a_channel) {
             case red:
-                return m_red;
+                return red_channel();
             case green:
-                return m_green;
+                return green_channel();
             case blue:
-                return m_blue;
+                return blue_channel();
+            case red_fine:
+            case green_fine:
+            case blue_fine:
+                return values()[*value_offset(a_channel)];
             default:
                 return 0;
         }
@@ -33,19 +40,62 @@ namespace monet::channel::attribute {
     void rgb_color::set_value(attribute_channel const a_channel, uint8_t const a_value) noexcept {
         switch (a_channel) {
             case red:
-                m_red = a_value;
+                set_red_channel(a_value);
                 break;
             case green:
-                m_green = a_value;
+                set_green_channel(a_value);
                 break;
             case blue:
-                m_blue = a_value;
+                set_blue_channel(a_value);
+                break;
+            case red_fine:
+            case green_fine:
+            case blue_fine:
+                values()[*value_offset(a_channel)] = a_value;
                 break;
             default:
                 break;
         }
     }
 
+    uint16_t rgb_color::value_16(attribute_channel const a_channel) const noexcept {
+        switch (a_channel) {
+            case red:
+            case green:
+            case blue:
+                return load_16(*value_offset(a_channel));
+            default:
+                return attribute::value_16(a_channel);
+        }
+    }
+
+    void rgb_color::set_value_16(attribute_channel const a_channel, uint16_t const a_value) noexcept {
+        switch (a_channel) {
+            case red:
+            case green:
+            case blue:
+                store_16(*value_offset(a_channel), a_value);
+                break;
+            default:
+                attribute::set_value_16(a_channel, a_value);
+        }
+    }
+
+    std::optional<size_t> rgb_color::value_offset(attribute_channel const a_channel) const noexcept {
+        switch (a_channel) {
+            case red:
+            case green:
+            case blue:
+                return (a_channel - red) * 2;
+            case red_fine:
+            case green_fine:
+            case blue_fine:
+                return (a_channel - red_fine) * 2 + 1;
+            default:
+                return std::nullopt;
+        }
+    }
+
     registry::register_attribute<"rgb_color", rgb_color> _rgb_color_registry;
 
 }
\ No newline at end of file
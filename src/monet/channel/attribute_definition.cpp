@@ -17,7 +17,7 @@ namespace monet::channel {
     }
 
     void attribute_definition::set_property(std::string a_property_name, std::string a_property_value) noexcept {
-        m_properties.emplace(std::move(a_property_name), std::move(a_property_value));
+        m_properties.insert_or_assign(std::move(a_property_name), std::move(a_property_value));
     }
 
 }
\ No newline at end of file
@@ -41,7 +41,7 @@ namespace monet::channel {
         // Clear any preexisting attributes.
         m_attributes.clear();
 
-        auto const& attribute_definitions = m_configuration.attributes();
+        auto const& attribute_definitions = std::as_const(m_configuration).attributes();
 
         // Iterate through each defined attribute type.
         for (auto const& [attribute_type, attributes] : attribute_definitions) {
@@ -49,7 +49,7 @@ namespace monet::channel {
 
             // Iterate through each attribute definition in each type.
             for (auto const& attribute_entry : attributes) {
-                generated_attributes.emplace_back(attribute::registry::instantiate_attribute(attribute_type));
+                generated_attributes.emplace_back(attribute::registry::instantiate_attribute(attribute_type, store()));
             }
 
             // Transfer generated attributes into the map.
@@ -58,38 +58,94 @@ namespace monet::channel {
                 std::move(generated_attributes)
             );
         }
+
+        compile_render_plan();
     }
 
-    std::vector<uint8_t> channel::fetch_address_values() const noexcept {
-        std::vector<uint8_t> address_values;
-        address_values.reserve(attribute_count());
-
-        for (auto const& [type, index, channel] : m_configuration.address_mappings()) {
-            if (auto const it = m_attributes.find(type); it != m_attributes.cend()) {
-                if (channel.empty()) {
-                    address_values.emplace_back(it->second[index]->value(0));
-                } else {
-                    auto const id = it->second[index]->channel_name_to_id(channel);
-                    address_values.emplace_back(it->second[index]->value(id));
-                }
+    std::span<render_entry const> channel::render_plan() const noexcept {
+        if (m_render_plan_revision != m_configuration.revision()) [[unlikely]] {
+            compile_render_plan();
+        }
+
+        return m_render_plan;
+    }
+
+    void channel::compile_render_plan() const noexcept {
+        auto const& address_mappings = std::as_const(m_configuration).address_mappings();
+
+        m_render_plan.clear();
+        m_render_plan.reserve(address_mappings.size());
+
+        for (auto const& [type, index, channel] : address_mappings) {
+            auto const it = m_attributes.find(type);
+
+            if (it == m_attributes.cend() || index >= it->second.size() || !it->second[index]) {
+                m_render_plan.push_back({ nullptr, attribute::attribute::base, nullptr });
+                continue;
+            }
+
+            auto const* attribute = it->second[index].get();
+            auto const channel_id = channel.empty() ? attribute::attribute::base : attribute->channel_name_to_id(channel);
+
+            // Pool values never move, so the pointer stays valid when the pool grows.
+            if (auto const offset = attribute->value_offset(channel_id)) {
+                m_render_plan.push_back({ attribute, channel_id, attribute->stored_values() + *offset });
             } else {
-                address_values.emplace_back(0);
+                m_render_plan.push_back({ attribute, channel_id, nullptr });
             }
         }
 
+        m_render_plan_revision = m_configuration.revision();
+    }
+
+    size_t channel::render(std::span<uint8_t> const a_destination) const noexcept {
+        auto const plan = render_plan();
+        auto const count = std::min(plan.size(), a_destination.size());
+
+        for (size_t i = 0; i < count; ++i) {
+            auto const& [attribute, channel, value] = plan[i];
+
+            if (value) [[likely]] {
+                a_destination[i] = *value;
+            } else {
+                a_destination[i] = attribute ? attribute->value(channel) : 0;
+            }
+        }
+
+        return count;
+    }
+
+    std::vector<uint8_t> channel::fetch_address_values() const noexcept {
+        std::vector<uint8_t> address_values(render_plan().size());
+
+        render(address_values);
+
         return address_values;
     }
 
+    attribute::attribute_store& channel::store() const noexcept {
+        return m_server ? m_server->attribute_store() : attribute::attribute_store::default_store();
+    }
+
     void channel::find_universe() {
         if (!m_server || m_base_address == 0) {
             m_universe = nullptr;
+            m_universe_number = 0;
             m_address = 0;
             return;
         }
 
         auto [universe, address] = address::from_master_id(m_base_address);
 
+        if (!address::universe_table::valid(universe)) [[unlikely]] {
+            m_universe = nullptr;
+            m_universe_number = 0;
+            m_address = 0;
+            return;
+        }
+
         m_universe = &m_server->get_universe(universe);
+        m_universe_number = universe;
         m_address = address;
     }
 
@@ -98,9 +154,7 @@ namespace monet::channel {
             return;
         }
 
-        auto [address, values] = address_info();
-
-        m_universe->set_addresses(address, values);
+        render(m_universe->address_range(m_address, render_plan().size()));
     }
 
     void channel::set_intensity(uint8_t const a_intensity) noexcept {
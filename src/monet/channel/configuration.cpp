@@ -34,6 +34,8 @@ namespace monet::channel {
     }
 
     void configuration::add_attribute(std::string a_attribute_type, attribute_definition a_attribute_definition) {
+        ++m_revision;
+
         auto it = std::find_if(
             m_attribute_definitions.begin(),
             m_attribute_definitions.end(),
@@ -86,11 +88,26 @@ namespace monet::channel {
         }
     }
 
+    bool configuration::set_attribute_property(std::string_view const a_attribute_type, size_t const a_attribute_index, std::string a_property_name, std::string a_property_value) {
+        auto const definitions = attributes(a_attribute_type);
+
+        if (a_attribute_index >= definitions.size()) {
+            return false;
+        }
+
+        definitions[a_attribute_index].set_property(std::move(a_property_name), std::move(a_property_value));
+        ++m_revision;
+
+        return true;
+    }
+
     address_mapping& configuration::mapping(size_t const a_address_index) {
         if (a_address_index >= address_count()) [[unlikely]] {
             throw std::out_of_range("address index exceeds amount of addresses");
         }
 
+        ++m_revision;
+
         return m_address_mappings[a_address_index];
     }
 
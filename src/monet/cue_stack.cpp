@@ -0,0 +1,137 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+
+namespace monet {
+
+    namespace {
+
+        /// Identifies an attribute channel in the tracked state.
+        struct tracked_key {
+            channel::attribute::attribute const* attribute;
+            channel::attribute_channel attribute_channel;
+
+            bool operator == (tracked_key const&) const noexcept = default;
+        };
+
+        struct tracked_key_hash {
+            size_t operator () (tracked_key const& a_key) const noexcept {
+                return std::hash<void const*>()(a_key.attribute) ^ (a_key.attribute_channel * 0x9E3779B97F4A7C15ull);
+            }
+        };
+
+        using tracked_state = std::unordered_map<tracked_key, cue_value, tracked_key_hash>;
+
+    }
+
+    void cue_stack::compile() {
+        tracked_state state;
+
+        m_deltas.resize(m_cues.size());
+
+        for (size_t i = 0; i < m_cues.size(); ++i) {
+            auto& delta = m_deltas[i];
+            delta.clear();
+
+            for (auto const& value : m_cues[i].values) {
+                auto const [it, inserted] = state.try_emplace({ value.attribute, value.attribute_channel }, value);
+
+                if (inserted || it->second.value != value.value) {
+                    it->second = value;
+                    delta.push_back(value);
+                }
+            }
+        }
+
+        m_compiled = true;
+    }
+
+    std::span<cue_value const> cue_stack::delta(size_t const a_index) {
+        if (!m_compiled) {
+            compile();
+        }
+
+        return m_deltas[a_index];
+    }
+
+    bool cue_stack::go(fade_engine& a_fades, std::vector<channel::channel*>& a_updated, clock::time_point const a_now) {
+        auto const next = m_current == npos ? 0 : m_current + 1;
+
+        if (next >= m_cues.size()) {
+            return false;
+        }
+
+        apply(delta(next), m_cues[next], a_fades, a_updated, a_now);
+        m_current = next;
+
+        return true;
+    }
+
+    bool cue_stack::go_to(
+        size_t const a_index,
+        fade_engine& a_fades,
+        std::vector<channel::channel*>& a_updated,
+        clock::time_point const a_now
+    ) {
+        if (a_index >= m_cues.size()) {
+            return false;
+        }
+
+        // Replay the tracked state up to the target cue.
+        tracked_state state;
+
+        for (size_t i = 0; i <= a_index; ++i) {
+            for (auto const& value : m_cues[i].values) {
+                state.insert_or_assign({ value.attribute, value.attribute_channel }, value);
+            }
+        }
+
+        std::vector<cue_value> values;
+        values.reserve(state.size());
+
+        for (auto const& [key, value] : state) {
+            values.push_back(value);
+        }
+
+        apply(values, m_cues[a_index], a_fades, a_updated, a_now);
+        m_current = a_index;
+
+        return true;
+    }
+
+    void cue_stack::remove_channel(channel::channel const& a_channel) {
+        for (auto& current_cue : m_cues) {
+            std::erase_if(current_cue.values, [&] (cue_value const& a_value) { return a_value.channel == &a_channel; });
+        }
+
+        m_compiled = false;
+    }
+
+    void cue_stack::apply(
+        std::span<cue_value const> const a_values,
+        cue const& a_cue,
+        fade_engine& a_fades,
+        std::vector<channel::channel*>& a_updated,
+        clock::time_point const a_now
+    ) {
+        for (auto const& value : a_values) {
+            auto const fading = a_fades.start(
+                *value.channel,
+                *value.attribute,
+                value.attribute_channel,
+                value.value,
+                a_cue.fade_time,
+                a_cue.curve,
+                a_now
+            );
+
+            // Fading channels are queued for rendering by the fade engine.
+            if (!fading) {
+                a_updated.push_back(value.channel);
+            }
+        }
+    }
+
+}
@@ -0,0 +1,187 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+
+namespace monet {
+
+    namespace {
+
+        /// Fractional part of a phase.
+        inline float wrap(float const a_phase) noexcept {
+            return a_phase - std::floor(a_phase);
+        }
+
+        /**
+         * @brief Approximate 0.5 + 0.5 * sin(2 * pi * phase) without branches or library calls, so loops over it
+         * vectorize.
+         *
+         * Uses the parabolic approximation of a half period with one refinement step (error below 0.1%).
+         */
+        inline float sine_01(float const a_phase) noexcept {
+            // Map each half period onto [0, 1) and flip the second half.
+            float const half = a_phase * 2.0f;
+            float const x = half - std::floor(half);
+            float const sign = half < 1.0f ? 1.0f : -1.0f;
+
+            float y = 4.0f * x * (1.0f - x);
+            y = 0.225f * (y * y - y) + y;
+
+            return 0.5f + 0.5f * sign * y;
+        }
+
+        /// Advance a xorshift32 generator.
+        inline uint32_t xorshift(uint32_t a_state) noexcept {
+            a_state ^= a_state << 13;
+            a_state ^= a_state >> 17;
+            a_state ^= a_state << 5;
+            return a_state;
+        }
+
+    }
+
+    void effect::add_member(
+        channel::channel& a_channel,
+        channel::attribute::attribute& a_attribute,
+        channel::attribute_channel const a_attribute_channel
+    ) {
+        m_members.push_back({ &a_channel, &a_attribute, a_attribute_channel });
+        m_phase_offsets.push_back(static_cast<float>(m_members.size() - 1) * m_spread);
+        // Any odd constant spreads the seeds; the state must never be zero.
+        m_noise_states.push_back(static_cast<uint32_t>(m_members.size()) * 2654435761u | 1u);
+        m_values.push_back(m_low);
+
+        if (std::find(m_channels.begin(), m_channels.end(), &a_channel) == m_channels.end()) {
+            m_channels.push_back(&a_channel);
+        }
+    }
+
+    void effect::remove_channel(channel::channel const& a_channel) {
+        size_t kept = 0;
+
+        // Compact the member arrays in place, preserving chase order.
+        for (size_t i = 0; i < m_members.size(); ++i) {
+            if (m_members[i].channel == &a_channel) {
+                continue;
+            }
+
+            m_members[kept] = m_members[i];
+            m_noise_states[kept] = m_noise_states[i];
+            m_values[kept] = m_values[i];
+            ++kept;
+        }
+
+        m_members.resize(kept);
+        m_phase_offsets.resize(kept);
+        m_noise_states.resize(kept);
+        m_values.resize(kept);
+
+        std::erase(m_channels, &a_channel);
+
+        compute_phase_offsets();
+    }
+
+    void effect::set_spread(float const a_spread) {
+        m_spread = a_spread;
+        compute_phase_offsets();
+    }
+
+    void effect::compute_phase_offsets() noexcept {
+        for (size_t i = 0; i < m_phase_offsets.size(); ++i) {
+            m_phase_offsets[i] = static_cast<float>(i) * m_spread;
+        }
+    }
+
+    void effect::evaluate(clock::time_point const a_now, worker_pool& a_pool) {
+        auto const start = clock::now();
+
+        // Phase of the first member, computed in double so long-running effects do not lose precision.
+        auto const elapsed = std::chrono::duration<double>(a_now - m_start_time).count();
+        auto const cycles = elapsed * m_rate;
+        auto const phase = static_cast<float>(cycles - std::floor(cycles));
+
+        auto const member_count = m_members.size();
+        auto const block_count = (member_count + effect_block_size - 1) / effect_block_size;
+
+        a_pool.run(block_count, [&] (size_t const a_block) {
+            auto const first = a_block * effect_block_size;
+            evaluate_block(phase, first, std::min(first + effect_block_size, member_count));
+        });
+
+        m_cost = clock::now() - start;
+    }
+
+    void effect::evaluate_block(float const a_phase, size_t const a_first, size_t const a_last) noexcept {
+        auto const* const offsets = m_phase_offsets.data();
+        auto* const values = m_values.data();
+
+        float const low = m_low;
+        float const range = static_cast<float>(m_high) - static_cast<float>(m_low);
+
+        // One loop per waveform over contiguous arrays, so each vectorizes.
+        switch (m_waveform) {
+            case effect_waveform::sine:
+                for (size_t i = a_first; i < a_last; ++i) {
+                    values[i] = static_cast<uint16_t>(low + range * sine_01(wrap(a_phase + offsets[i])) + 0.5f);
+                }
+                break;
+            case effect_waveform::triangle:
+                for (size_t i = a_first; i < a_last; ++i) {
+                    float const level = 1.0f - std::fabs(2.0f * wrap(a_phase + offsets[i]) - 1.0f);
+                    values[i] = static_cast<uint16_t>(low + range * level + 0.5f);
+                }
+                break;
+            case effect_waveform::square: {
+                float const duty = m_duty;
+
+                for (size_t i = a_first; i < a_last; ++i) {
+                    float const level = wrap(a_phase + offsets[i]) < duty ? 1.0f : 0.0f;
+                    values[i] = static_cast<uint16_t>(low + range * level + 0.5f);
+                }
+                break;
+            }
+            case effect_waveform::noise: {
+                auto* const states = m_noise_states.data();
+
+                for (size_t i = a_first; i < a_last; ++i) {
+                    states[i] = xorshift(states[i]);
+                    float const level = static_cast<float>(states[i] >> 16) * (1.0f / 65535.0f);
+                    values[i] = static_cast<uint16_t>(low + range * level + 0.5f);
+                }
+                break;
+            }
+        }
+
+        for (size_t i = a_first; i < a_last; ++i) {
+            auto const& member = m_members[i];
+            member.attribute->set_value_16(member.attribute_channel, values[i]);
+        }
+    }
+
+    void effect_engine::destroy(effect const& a_effect) noexcept {
+        std::erase_if(m_effects, [&] (auto const& a_other) { return a_other.get() == &a_effect; });
+    }
+
+    void effect_engine::remove_channel(channel::channel const& a_channel) {
+        for (auto& current_effect : m_effects) {
+            current_effect->remove_channel(a_channel);
+        }
+    }
+
+    void effect_engine::advance(
+        effect::clock::time_point const a_now,
+        worker_pool& a_pool,
+        std::vector<channel::channel*>& a_updated
+    ) {
+        auto const start = effect::clock::now();
+
+        for (auto& current_effect : m_effects) {
+            current_effect->evaluate(a_now, a_pool);
+            a_updated.insert(a_updated.end(), current_effect->channels().begin(), current_effect->channels().end());
+        }
+
+        m_cost = effect::clock::now() - start;
+    }
+
+}
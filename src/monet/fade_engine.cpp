@@ -0,0 +1,181 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+
+namespace monet {
+
+    bool fade_engine::start(
+        channel::channel& a_channel,
+        channel::attribute::attribute& a_attribute,
+        channel::attribute_channel const a_attribute_channel,
+        uint16_t const a_target_value,
+        clock::duration const a_duration,
+        fade_curve const a_curve,
+        clock::time_point const a_now
+    ) {
+        if (a_duration <= clock::duration::zero()) {
+            cancel(a_attribute, a_attribute_channel);
+            a_attribute.set_value_16(a_attribute_channel, a_target_value);
+            return false;
+        }
+
+        fade const new_fade{
+            .channel = &a_channel,
+            .attribute = &a_attribute,
+            .attribute_channel = a_attribute_channel,
+            .start_time = a_now,
+            .duration = a_duration,
+            .start_value = a_attribute.value_16(a_attribute_channel),
+            .target_value = a_target_value,
+            .curve = a_curve
+        };
+
+        auto slot = find_slot(&a_attribute, a_attribute_channel);
+
+        if (m_fade_slots[slot].attribute != nullptr) {
+            m_fades[m_fade_slots[slot].index] = new_fade;
+            return true;
+        }
+
+        if ((m_fades.size() + 1) * 2 > m_fade_slots.size()) {
+            grow_slots();
+            slot = find_slot(&a_attribute, a_attribute_channel);
+        }
+
+        m_fade_slots[slot] = { &a_attribute, a_attribute_channel, static_cast<uint32_t>(m_fades.size()) };
+        m_fades.push_back(new_fade);
+
+        return true;
+    }
+
+    void fade_engine::cancel(
+        channel::attribute::attribute const& a_attribute,
+        channel::attribute_channel const a_attribute_channel
+    ) noexcept {
+        if (auto const slot = find_slot(&a_attribute, a_attribute_channel); m_fade_slots[slot].attribute != nullptr) {
+            retire(m_fade_slots[slot].index);
+        }
+    }
+
+    void fade_engine::cancel(channel::channel const& a_channel) noexcept {
+        for (size_t i = 0; i < m_fades.size();) {
+            if (m_fades[i].channel == &a_channel) {
+                retire(i);
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    void fade_engine::advance(clock::time_point const a_now, std::vector<channel::channel*>& a_updated) {
+        for (size_t i = 0; i < m_fades.size();) {
+            auto const& current_fade = m_fades[i];
+
+            current_fade.attribute->set_value_16(current_fade.attribute_channel, evaluate(current_fade, a_now));
+            a_updated.push_back(current_fade.channel);
+
+            // The retired slot is refilled with the last fade, which still needs advancing this frame.
+            if (a_now - current_fade.start_time >= current_fade.duration) {
+                retire(i);
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    void fade_engine::retire(size_t const a_index) noexcept {
+        auto const& retired_fade = m_fades[a_index];
+        erase_slot(find_slot(retired_fade.attribute, retired_fade.attribute_channel));
+
+        if (a_index != m_fades.size() - 1) {
+            auto const& last_fade = m_fades.back();
+            m_fade_slots[find_slot(last_fade.attribute, last_fade.attribute_channel)].index = static_cast<uint32_t>(a_index);
+            m_fades[a_index] = last_fade;
+        }
+
+        m_fades.pop_back();
+    }
+
+    size_t fade_engine::find_slot(
+        channel::attribute::attribute const* const a_attribute,
+        channel::attribute_channel const a_attribute_channel
+    ) const noexcept {
+        auto const mask = m_fade_slots.size() - 1;
+        auto slot = slot_hash(a_attribute, a_attribute_channel) & mask;
+
+        while (m_fade_slots[slot].attribute != nullptr
+            && (m_fade_slots[slot].attribute != a_attribute || m_fade_slots[slot].attribute_channel != a_attribute_channel)) {
+            slot = (slot + 1) & mask;
+        }
+
+        return slot;
+    }
+
+    void fade_engine::erase_slot(size_t a_slot) noexcept {
+        auto const mask = m_fade_slots.size() - 1;
+
+        // Backward-shift deletion: move up every following entry whose probe sequence passes the emptied slot.
+        for (auto next = (a_slot + 1) & mask; m_fade_slots[next].attribute != nullptr; next = (next + 1) & mask) {
+            auto const home = slot_hash(m_fade_slots[next].attribute, m_fade_slots[next].attribute_channel) & mask;
+
+            if (((next - home) & mask) >= ((next - a_slot) & mask)) {
+                m_fade_slots[a_slot] = m_fade_slots[next];
+                a_slot = next;
+            }
+        }
+
+        m_fade_slots[a_slot] = {};
+    }
+
+    void fade_engine::grow_slots() {
+        std::vector<fade_slot> slots(m_fade_slots.size() * 2);
+        std::swap(slots, m_fade_slots);
+
+        for (auto const& slot : slots) {
+            if (slot.attribute != nullptr) {
+                m_fade_slots[find_slot(slot.attribute, slot.attribute_channel)] = slot;
+            }
+        }
+    }
+
+    uint16_t fade_engine::evaluate(fade const& a_fade, clock::time_point const a_now) noexcept {
+        auto const elapsed = a_now - a_fade.start_time;
+
+        if (elapsed >= a_fade.duration) {
+            return a_fade.target_value;
+        }
+
+        if (elapsed <= clock::duration::zero()) {
+            return a_fade.start_value;
+        }
+
+        // Progress and curves in 0.16 fixed-point.
+        constexpr int64_t one = 1 << 16;
+
+        int64_t progress = elapsed.count() * one / a_fade.duration.count();
+
+        switch (a_fade.curve) {
+            case fade_curve::ease_in:
+                progress = progress * progress / one;
+                break;
+            case fade_curve::ease_out:
+                progress = progress * (2 * one - progress) / one;
+                break;
+            case fade_curve::ease_in_out:
+                progress = progress * progress / one * (3 * one - 2 * progress) / one;
+                break;
+            case fade_curve::linear:
+            default:
+                break;
+        }
+
+        auto const delta = static_cast<int64_t>(a_fade.target_value) - a_fade.start_value;
+
+        auto const rounding = delta < 0 ? -one / 2 : one / 2;
+
+        return static_cast<uint16_t>(a_fade.start_value + (delta * progress + rounding) / one);
+    }
+
+}
@@ -0,0 +1,44 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <thread>
+
+#include <monet.hpp>
+
+namespace monet {
+
+    void frame_scheduler::reset(clock::duration const a_phase) noexcept {
+        m_next_deadline = clock::now() + frame_time() + a_phase;
+        m_frame_count = 0;
+        m_missed_frames = 0;
+    }
+
+    void frame_scheduler::wait() noexcept {
+        auto const frame_duration = std::chrono::duration_cast<clock::duration>(frame_time());
+        auto const deadline = m_next_deadline;
+        auto now = clock::now();
+
+        if (now < deadline) {
+            // Sleep through most of the frame, leaving the spin time to absorb scheduler wake-up jitter.
+            if (deadline - now > m_spin_time) {
+                std::this_thread::sleep_until(deadline - m_spin_time);
+            }
+
+            while (clock::now() < deadline) {
+                std::this_thread::yield();
+            }
+
+            m_next_deadline = deadline + frame_duration;
+        } else {
+            // Running late. Skip every deadline that has passed entirely and stay on the original grid.
+            auto const skipped = (now - deadline) / frame_duration;
+
+            m_missed_frames.fetch_add(static_cast<size_t>(skipped), std::memory_order_relaxed);
+            m_next_deadline = deadline + (skipped + 1) * frame_duration;
+        }
+
+        m_frame_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+}
@@ -0,0 +1,286 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+
+namespace monet::interface {
+
+    live_feed::live_feed() noexcept :
+        m_subscribers(0),
+        m_stopping(false),
+        m_thread(),
+        m_pending_frame(0),
+        m_published_stale(false),
+        m_sequence(0)
+    {}
+
+    live_feed::~live_feed() {
+        stop();
+    }
+
+    void live_feed::start() {
+        stop();
+
+        m_stopping.store(false, std::memory_order_release);
+
+        m_thread = std::thread([this] {
+            while (true) {
+                {
+                    std::unique_lock lock(m_capture_mutex);
+
+                    m_capture_condition.wait(lock, [this] {
+                        return stopping() || !m_pending_channels.empty() || !m_removed_channels.empty();
+                    });
+
+                    if (stopping()) {
+                        return;
+                    }
+                }
+
+                publish();
+            }
+        });
+    }
+
+    void live_feed::stop() {
+        // Taking each lock before notifying ensures no waiter misses the stop between its check and its wait.
+        {
+            std::lock_guard lock(m_capture_mutex);
+            m_stopping.store(true, std::memory_order_release);
+        }
+
+        m_capture_condition.notify_all();
+
+        {
+            std::lock_guard lock(m_event_mutex);
+        }
+
+        m_event_condition.notify_all();
+
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+    }
+
+    void live_feed::capture(server const& a_server, std::span<channel::channel* const> const a_channels, uint64_t const a_frame) {
+        if (m_subscribers.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+
+        bool notify;
+
+        {
+            std::lock_guard lock(m_capture_mutex);
+
+            notify = m_pending_channels.empty();
+
+            for (auto* const channel : a_channels) {
+                auto const channel_number = a_server.channel_number(*channel);
+
+                if (!channel_number) {
+                    continue;
+                }
+
+                auto& captured = m_captured[*channel_number];
+
+                // Overwrites the values of an earlier frame that have not been published yet.
+                captured.values.clear();
+
+                for (auto const& [attribute_type, attributes] : channel->attributes()) {
+                    for (size_t attribute_index = 0; attribute_index < attributes.size(); ++attribute_index) {
+                        auto& attribute = *attributes[attribute_index];
+                        auto const available_channels = attribute.available_channels();
+
+                        for (size_t attribute_channel = 0; attribute_channel < available_channels.size(); ++attribute_channel) {
+                            captured.values.push_back({
+                                .type = attribute.name(),
+                                .index = attribute_index,
+                                .channel = available_channels[attribute_channel],
+                                .value = attribute.value(attribute_channel)
+                            });
+                        }
+                    }
+                }
+
+                if (!captured.pending) {
+                    captured.pending = true;
+                    m_pending_channels.push_back(*channel_number);
+                }
+            }
+
+            m_pending_frame = a_frame;
+        }
+
+        if (notify) {
+            m_capture_condition.notify_one();
+        }
+    }
+
+    void live_feed::remove_channel(size_t const a_channel_number) {
+        bool notify;
+
+        {
+            std::lock_guard lock(m_capture_mutex);
+
+            notify = m_pending_channels.empty() && m_removed_channels.empty();
+
+            m_captured.erase(a_channel_number);
+            std::erase(m_pending_channels, a_channel_number);
+            m_removed_channels.push_back(a_channel_number);
+        }
+
+        if (notify) {
+            m_capture_condition.notify_one();
+        }
+    }
+
+    bool live_feed::publish() {
+        uint64_t frame;
+        bool stale;
+
+        // Only copy under the lock; the render thread must not wait for serialization.
+        {
+            std::lock_guard lock(m_capture_mutex);
+
+            m_batch.resize(m_pending_channels.size());
+
+            for (size_t i = 0; i < m_pending_channels.size(); ++i) {
+                auto& captured = m_captured[m_pending_channels[i]];
+
+                m_batch[i].first = m_pending_channels[i];
+                m_batch[i].second.assign(captured.values.cbegin(), captured.values.cend());
+                captured.pending = false;
+            }
+
+            m_pending_channels.clear();
+            m_removed_batch.swap(m_removed_channels);
+            m_removed_channels.clear();
+            frame = m_pending_frame;
+            stale = std::exchange(m_published_stale, false);
+        }
+
+        if (stale) {
+            m_published.clear();
+        }
+
+        auto channels_data = nlohmann::json::object();
+
+        // Only channels subscribers were sent are reported deleted. A channel created again under the same number
+        // since is sent in full below.
+        for (auto const channel_number : m_removed_batch) {
+            if (m_published.erase(channel_number) != 0) {
+                channels_data[std::to_string(channel_number)] = nullptr;
+            }
+        }
+
+        for (auto const& [channel_number, values] : m_batch) {
+            auto& published = m_published[channel_number];
+
+            // Values are captured in the same order every time, unless the channel was reconfigured.
+            auto const comparable = published.size() == values.size();
+            nlohmann::json* channel_data = nullptr;
+
+            for (size_t i = 0; i < values.size(); ++i) {
+                auto const& [type, index, attribute_channel, value] = values[i];
+
+                if (comparable && published[i].value == value) {
+                    continue;
+                }
+
+                if (!channel_data) {
+                    channel_data = &channels_data[std::to_string(channel_number)];
+                }
+
+                (*channel_data)[std::string(type)][index][std::string(attribute_channel)] = value;
+            }
+
+            published.assign(values.cbegin(), values.cend());
+        }
+
+        if (channels_data.empty()) {
+            return false;
+        }
+
+        std::lock_guard lock(m_event_mutex);
+
+        auto const sequence = m_sequence + 1;
+
+        auto const data = nlohmann::json({
+            { "sequence", sequence },
+            { "frame", frame },
+            { "channels", std::move(channels_data) }
+        });
+
+        m_events.push_back(std::make_shared<event const>(event{
+            .sequence = sequence,
+            .message = "id: " + std::to_string(sequence) + "\nevent: delta\ndata: " + to_string(data) + "\n\n"
+        }));
+
+        if (m_events.size() > live_feed_backlog) {
+            m_events.pop_front();
+        }
+
+        m_sequence = sequence;
+        m_event_condition.notify_all();
+
+        return true;
+    }
+
+    bool live_feed::subscribe(size_t const a_max_subscribers) noexcept {
+        auto subscribers = m_subscribers.load(std::memory_order_relaxed);
+
+        do {
+            if (subscribers >= a_max_subscribers) {
+                return false;
+            }
+        } while (!m_subscribers.compare_exchange_weak(subscribers, subscribers + 1, std::memory_order_relaxed));
+
+        // Values changed while nobody was subscribed, so compare the next ones against nothing.
+        if (subscribers == 0) {
+            std::lock_guard lock(m_capture_mutex);
+            m_published_stale = true;
+        }
+
+        return true;
+    }
+
+    uint64_t live_feed::sequence() const noexcept {
+        std::lock_guard lock(m_event_mutex);
+        return m_sequence;
+    }
+
+    std::shared_ptr<live_feed::event const> live_feed::next_event(std::optional<uint64_t> const a_last_sequence, std::chrono::milliseconds const a_timeout) {
+        std::unique_lock lock(m_event_mutex);
+
+        // New subscribers, and subscribers with a sequence number from before a restart, start from the full state.
+        if (!a_last_sequence || *a_last_sequence > m_sequence) {
+            return resync_event(m_sequence);
+        }
+
+        auto const last_sequence = *a_last_sequence;
+
+        if (!m_event_condition.wait_for(lock, a_timeout, [&] { return stopping() || m_sequence > last_sequence; }) || stopping()) {
+            return nullptr;
+        }
+
+        // Fell behind further than the backlog reaches.
+        if (m_events.empty() || last_sequence + 1 < m_events.front()->sequence) {
+            return resync_event(m_sequence);
+        }
+
+        return m_events[last_sequence + 1 - m_events.front()->sequence];
+    }
+
+    std::shared_ptr<live_feed::event const> live_feed::resync_event(uint64_t const a_sequence) {
+        auto const data = nlohmann::json({
+            { "sequence", a_sequence }
+        });
+
+        return std::make_shared<event const>(event{
+            .sequence = a_sequence,
+            .message = "id: " + std::to_string(a_sequence) + "\nevent: resync\ndata: " + to_string(data) + "\n\n"
+        });
+    }
+
+}
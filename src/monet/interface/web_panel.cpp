@@ -2,6 +2,7 @@
 // Created by maxng on 12/6/2023.
 //
 
+#include <charconv>
 #include <sstream>
 
 #include <monet.hpp>
@@ -10,6 +11,7 @@ namespace monet::interface {
 
     void web_panel::start() {
         setup_api_endpoints();
+        m_feed.start();
 
         m_main_thread = std::thread([&] {
             m_server = std::make_unique<httplib::SSLServer>(
@@ -17,6 +19,11 @@ namespace monet::interface {
                 m_private_key_file.c_str()
             );
 
+            // Live feed subscribers each hold a thread, so serve more than the default.
+            m_server->new_task_queue = [thread_count = m_thread_count] {
+                return new httplib::ThreadPool(thread_count);
+            };
+
             // API request.
             m_server->Get(R"(/api(.+))", [this](httplib::Request const& req, httplib::Response& res) {
                 std::string const api_path{req.matches[1]};
@@ -92,6 +99,8 @@ namespace monet::interface {
     }
 
     void web_panel::stop() {
+        // End the streams of live feed subscribers, which would otherwise keep their threads busy.
+        m_feed.stop();
         m_server->stop();
     }
 
@@ -129,12 +138,13 @@ namespace monet::interface {
         api_get("/channels/configurations", {
             .callback = [this] (httplib::Request const& req, httplib::Response& res) {
                 auto response = nlohmann::json();
+                auto const lock = m_host.lock_channels();
 
                 for (auto& [name, configuration] : m_host.channel_configurations()) {
                     auto attributes_data = nlohmann::json();
                     auto address_mappings_data = nlohmann::json::array();
 
-                    for (auto const & [attribute_type, attributes] : configuration->attributes()) {
+                    for (auto const & [attribute_type, attributes] : std::as_const(*configuration).attributes()) {
                         auto attributes_list = nlohmann::json::array();
 
                         for (auto const& attribute : attributes) {
@@ -153,7 +163,7 @@ namespace monet::interface {
                         attributes_data[attribute_type] = attributes_list;
                     }
 
-                    for (auto const& [type, index, channel] : configuration->address_mappings()) {
+                    for (auto const& [type, index, channel] : std::as_const(*configuration).address_mappings()) {
                         // address_mappings_data.push_back(nlohmann::json::array({
                         //     type,
                         //     index,
@@ -182,39 +192,107 @@ namespace monet::interface {
 
         api_get("/channels", {
             .callback = [this] (httplib::Request const& req, httplib::Response& res) {
-                auto channels_data = nlohmann::json();
+                /// An attribute of a channel, with its values starting at first_value.
+                struct attribute_values {
+                    std::string_view type;
+                    std::string name;
+                    std::span<std::string_view const> channels;
+                    size_t first_value;
+                };
+
+                /// A channel, with its attributes and address values starting at first_attribute and first_address.
+                struct channel_values {
+                    size_t number;
+                    size_t base_address;
+                    std::string_view configuration;
+                    size_t first_attribute;
+                    size_t first_address;
+                    size_t address_count;
+                };
+
+                std::vector<channel_values> channels;
+                std::vector<attribute_values> attributes;
+                std::vector<uint8_t> values;
+                std::vector<uint8_t> addresses;
+
+                {
+                    // Holding the lock stalls the render thread, so only the values are copied under it. Keeps the
+                    // render thread from changing the values, or channels from being created or deleted, midway.
+                    auto const lock = m_host.lock_channels();
+
+                    channels.reserve(m_host.channels().size());
+
+                    for (auto& [index, channel] : m_host.channels()) {
+                        auto const address_count = channel->render_plan().size();
+                        auto const first_address = addresses.size();
+
+                        channels.push_back({
+                            .number = index,
+                            .base_address = channel->base_address(),
+                            .configuration = channel->config().name(),
+                            .first_attribute = attributes.size(),
+                            .first_address = first_address,
+                            .address_count = address_count
+                        });
 
-                for (auto& [index, channel] : m_host.channels()) {
-                    auto attributes_data = nlohmann::json();
+                        for (auto const& [attribute_type, channel_attributes] : channel->attributes()) {
+                            auto const& definitions = std::as_const(channel->config()).attributes(attribute_type);
 
-                    for (auto const& [attribute_type, attributes] : channel->attributes()) {
-                        auto attribute_type_data = nlohmann::json::array();
+                            for (size_t i = 0; i < channel_attributes.size(); ++i) {
+                                auto const& attribute = *channel_attributes[i];
+                                auto const available_channels = attribute.available_channels();
 
-                        for (int i = 0; i < attributes.size(); ++i) {
-                            auto const& attribute = *attributes[i];
+                                attributes.push_back({
+                                    .type = attribute_type,
+                                    .name = std::string(definitions[i].name()),
+                                    .channels = available_channels,
+                                    .first_value = values.size()
+                                });
 
-                            auto attribute_channel_data = nlohmann::json();
+                                for (size_t ii = 0; ii < available_channels.size(); ++ii) {
+                                    values.push_back(attribute.value(ii));
+                                }
+                            }
+                        }
 
-                            auto const& available_channels = attribute.available_channels();
+                        addresses.resize(first_address + address_count);
+                        channel->render(std::span(addresses).subspan(first_address));
+                    }
+                }
 
-                            for (int ii = 0; ii < available_channels.size(); ++ii) {
-                                attribute_channel_data[available_channels[ii]] = attribute.value(ii);
-                            }
+                auto channels_data = nlohmann::json();
 
-                            attribute_type_data.push_back(nlohmann::json({
-                                { "name", channel->config().attributes(attribute_type)[i].name() },
-                                { "channels", attribute_channel_data }
-                            }));
+                for (size_t channel_index = 0; channel_index < channels.size(); ++channel_index) {
+                    auto const& channel = channels[channel_index];
+
+                    auto const end_attribute = channel_index + 1 < channels.size()
+                        ? channels[channel_index + 1].first_attribute
+                        : attributes.size();
+
+                    auto attributes_data = nlohmann::json();
+
+                    for (auto attribute_index = channel.first_attribute; attribute_index < end_attribute; ++attribute_index) {
+                        auto const& attribute = attributes[attribute_index];
+
+                        auto attribute_channel_data = nlohmann::json();
+
+                        for (size_t ii = 0; ii < attribute.channels.size(); ++ii) {
+                            attribute_channel_data[attribute.channels[ii]] = values[attribute.first_value + ii];
                         }
 
-                        attributes_data[attribute_type] = attribute_type_data;
+                        attributes_data[attribute.type].push_back(nlohmann::json({
+                            { "name", attribute.name },
+                            { "channels", attribute_channel_data }
+                        }));
                     }
 
-                    channels_data[index] = nlohmann::json({
-                        { "base_address", channel->base_address() },
-                        { "configuration", channel->config().name() },
+                    auto const first_address = addresses.cbegin() + static_cast<ptrdiff_t>(channel.first_address);
+
+                    channels_data[channel.number] = nlohmann::json({
+                        { "base_address", channel.base_address },
+                        { "configuration", channel.configuration },
                         { "attributes", attributes_data },
-                        { "addresses", channel->fetch_address_values() }
+                        { "addresses", std::vector<uint8_t>(first_address, first_address + static_cast<ptrdiff_t>(channel.address_count)) }
                     });
                 }
 
@@ -222,34 +300,176 @@ namespace monet::interface {
             }
         });
 
+        api_get("/live", {
+            .callback = [this] (httplib::Request const& req, httplib::Response& res) {
+                std::optional<uint64_t> last_sequence;
+
+                // EventSource sends the ID of the last event it received when it reconnects.
+                if (auto const last_event_id = req.get_header_value("Last-Event-ID"); !last_event_id.empty()) {
+                    uint64_t sequence;
+
+                    if (auto const [end, error] = std::from_chars(last_event_id.data(), last_event_id.data() + last_event_id.size(), sequence); error == std::errc()) {
+                        last_sequence = sequence;
+                    }
+                }
+
+                // Every subscriber holds a thread, so some are kept free for the other endpoints.
+                if (!m_feed.subscribe(max_live_subscribers())) {
+                    auto const response = nlohmann::json({
+                        { "error", "Too many live feed subscribers." }
+                    });
+
+                    res.status = 503;
+                    return res.set_content(to_string(response), "application/json");
+                }
+
+                res.set_header("Cache-Control", "no-cache");
+                res.set_chunked_content_provider(
+                    "text/event-stream",
+                    [this, last_sequence] (size_t, httplib::DataSink& sink) mutable {
+                        auto const event = m_feed.next_event(last_sequence, live_feed_keep_alive_interval);
+
+                        if (m_feed.stopping()) {
+                            return false;
+                        }
+
+                        if (!event) {
+                            constexpr std::string_view keep_alive = ": keep-alive\n\n";
+                            return sink.write(keep_alive.data(), keep_alive.size());
+                        }
+
+                        // The event is shared by every subscriber; it is only written here.
+                        last_sequence = event->sequence;
+                        return sink.write(event->message.data(), event->message.size());
+                    },
+                    [this] (bool) {
+                        m_feed.unsubscribe();
+                    }
+                );
+            }
+        });
+
         api_post("/channel", {
             .callback = [this] (httplib::Request const& req, httplib::Response& res) {
                 auto request_data = nlohmann::json::parse(req.body);
 
                 auto const channel_number = request_data["channel"].get<size_t>();
+                auto const fade_time = std::chrono::milliseconds(request_data.value<size_t>("fade", 0));
+
+                auto const& attributes_field = request_data["attributes"];
 
-                auto* channel = m_host.channel_by_number(channel_number);
+                // Checked up front so a bad value does not leave the request half applied.
+                if (attributes_field.is_object()) {
+                    for (auto const& [attribute_type, attribute_list] : attributes_field.items()) {
+                        for (auto const& attribute_data : attribute_list) {
+                            if (attribute_data.is_null()) {
+                                continue;
+                            }
+
+                            for (auto const& [attribute_channel, attribute_channel_value] : attribute_data.items()) {
+                                if (!attribute_channel_value.is_number_unsigned() || attribute_channel_value.get<uint64_t>() > 255) {
+                                    auto const response = nlohmann::json({
+                                        { "error", "Attribute values must be from 0 to 255." }
+                                    });
+
+                                    res.status = 400;
+                                    return res.set_content(to_string(response), "application/json");
+                                }
+                            }
+                        }
+                    }
+                }
 
-                if (auto const& attributes_field = request_data["attributes"]; attributes_field.is_object()) {
-                    for (auto const& [attribute_type, attribute_list] : request_data["attributes"].items()) {
-                        auto const& channel_attributes = channel->attributes(attribute_type);
+                bool queued = true;
 
+                // Mutations are applied by the render thread at the start of the next frame.
+                if (attributes_field.is_object()) {
+                    for (auto const& [attribute_type, attribute_list] : attributes_field.items()) {
                         for (size_t attribute_index = 0; attribute_index < attribute_list.size(); ++attribute_index) {
                             auto const& attribute_data = attribute_list[attribute_index];
-                            auto const& channel_attribute = channel_attributes[attribute_index];
 
                             if (attribute_data.is_null()) {
                                 continue;
                             }
 
                             for (auto const& [attribute_channel, attribute_channel_value] : attribute_data.items()) {
-                                channel_attribute->set_value(channel_attribute->channel_name_to_id(attribute_channel), attribute_channel_value.get<size_t>());
+                                queued &= m_host.enqueue_command({
+                                    .type = command::command_type::set_attribute_value,
+                                    .target = channel_number,
+                                    .attribute_type = attribute_type,
+                                    .attribute_index = attribute_index,
+                                    .attribute_channel = attribute_channel,
+                                    .value = static_cast<uint8_t>(attribute_channel_value.get<uint64_t>()),
+                                    .fade_time = fade_time
+                                });
                             }
                         }
                     }
                 }
 
-                channel->push_updates();
+                if (!queued) {
+                    auto const response = nlohmann::json({
+                        { "error", "Too many pending updates." }
+                    });
+
+                    res.status = 503;
+                    res.set_content(to_string(response), "application/json");
+                }
+            }
+        });
+
+        api_post("/cue_stack/go", {
+            .callback = [this] (httplib::Request const& req, httplib::Response& res) {
+                auto request_data = nlohmann::json::parse(req.body);
+
+                command go_command{
+                    .type = command::command_type::go_cue,
+                    .target = request_data["cue_stack"].get<size_t>()
+                };
+
+                // Jump to a specific cue if one is given, otherwise go to the next one.
+                if (auto const& cue_field = request_data["cue"]; cue_field.is_number_unsigned()) {
+                    go_command.type = command::command_type::go_to_cue;
+                    go_command.cue_index = cue_field.get<size_t>();
+                }
+
+                if (!m_host.enqueue_command(std::move(go_command))) {
+                    auto const response = nlohmann::json({
+                        { "error", "Too many pending updates." }
+                    });
+
+                    res.status = 503;
+                    res.set_content(to_string(response), "application/json");
+                }
+            }
+        });
+
+        api_post("/grand_master", {
+            .callback = [this] (httplib::Request const& req, httplib::Response& res) {
+                auto request_data = nlohmann::json::parse(req.body);
+
+                auto const& level_field = request_data["level"];
+
+                if (!level_field.is_number_unsigned() || level_field.get<uint64_t>() > 255) {
+                    auto const response = nlohmann::json({
+                        { "error", "Level must be from 0 to 255." }
+                    });
+
+                    res.status = 400;
+                    return res.set_content(to_string(response), "application/json");
+                }
+
+                if (!m_host.enqueue_command({
+                    .type = command::command_type::set_grand_master,
+                    .value = static_cast<uint8_t>(level_field.get<uint64_t>())
+                })) {
+                    auto const response = nlohmann::json({
+                        { "error", "Too many pending updates." }
+                    });
+
+                    res.status = 503;
+                    res.set_content(to_string(response), "application/json");
+                }
             }
         });
     }
@@ -0,0 +1,104 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <algorithm>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <monet.hpp>
+
+namespace monet::recording {
+
+    reader::reader() noexcept :
+        m_file(-1),
+        m_mapping(nullptr),
+        m_size(0)
+    {}
+
+    reader::~reader() {
+        close();
+    }
+
+    bool reader::open(std::filesystem::path const& a_file) {
+        close();
+
+        if ((m_file = ::open(a_file.c_str(), O_RDONLY)) < 0) {
+            return false;
+        }
+
+        struct stat file_status{};
+
+        if (fstat(m_file, &file_status) < 0 || static_cast<size_t>(file_status.st_size) < sizeof(file_header)) {
+            close();
+            return false;
+        }
+
+        m_size = static_cast<size_t>(file_status.st_size);
+        m_mapping = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, m_file, 0);
+
+        if (m_mapping == MAP_FAILED) {
+            m_mapping = nullptr;
+            close();
+            return false;
+        }
+
+        auto const& file = header();
+
+        if (file.magic != file_magic || file.version != file_version || file.record_size != sizeof(record)) {
+            close();
+            return false;
+        }
+
+        return true;
+    }
+
+    void reader::close() noexcept {
+        if (m_mapping) {
+            munmap(m_mapping, m_size);
+            m_mapping = nullptr;
+        }
+
+        if (m_file >= 0) {
+            ::close(m_file);
+            m_file = -1;
+        }
+
+        m_size = 0;
+    }
+
+    std::span<record const> reader::records() const noexcept {
+        if (!m_mapping) {
+            return {};
+        }
+
+        // The recorder may still be writing; only count records the header says are complete and that are mapped.
+        auto const written = std::atomic_ref(const_cast<file_header&>(header()).record_count).load(std::memory_order_acquire);
+        auto const mapped = (m_size - sizeof(file_header)) / sizeof(record);
+
+        return {
+            reinterpret_cast<record const*>(static_cast<uint8_t const*>(m_mapping) + sizeof(file_header)),
+            std::min<size_t>(written, mapped)
+        };
+    }
+
+    size_t reader::seek(std::chrono::nanoseconds const a_time) const noexcept {
+        auto const all = records();
+
+        // First record after the time, then back to the index entry that starts its keyframe.
+        auto const after = std::ranges::upper_bound(all, static_cast<uint64_t>(std::max<int64_t>(a_time.count(), 0)), std::less{}, &record::time);
+        auto const index = std::find_if(
+            std::make_reverse_iterator(after),
+            all.rend(),
+            [] (record const& a_record) {
+                return a_record.index();
+            }
+        );
+
+        return index == all.rend() ? all.size() : static_cast<size_t>(std::distance(all.begin(), index.base()) - 1);
+    }
+
+}
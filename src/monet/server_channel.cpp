@@ -18,15 +18,53 @@ namespace monet {
         return it != m_channels.cend() ? it->second.get() : nullptr;
     }
 
+    std::optional<size_t> server::channel_number(channel::channel const& a_channel) const noexcept {
+        auto const it = m_channel_numbers.find(&a_channel);
+
+        return it != m_channel_numbers.cend() ? std::optional(it->second) : std::nullopt;
+    }
+
     channel::channel& server::create_channel(size_t const a_id, std::string_view const a_configuration, size_t const a_base_address) {
-        return *m_channels.emplace(a_id, std::make_unique<channel::channel>(channel_configuration(a_configuration), this, a_base_address)).first->second;
+        return create_channel(a_id, channel_configuration(a_configuration), a_base_address);
+    }
+
+    channel::channel& server::create_channel(size_t const a_id, channel::configuration& a_configuration, size_t const a_base_address) {
+        std::scoped_lock const lock(m_mutex);
+
+        m_output_stage_stale = true;
+
+        auto const [it, created] = m_channels.emplace(a_id, std::make_unique<channel::channel>(a_configuration, this, a_base_address));
+
+        if (created) {
+            m_channel_numbers.emplace(it->second.get(), a_id);
+        }
+
+        return *it->second;
     }
 
     void server::delete_channel(size_t const a_id) noexcept {
-        m_channels.erase(a_id);
+        std::scoped_lock const lock(m_mutex);
+
+        if (auto const it = m_channels.find(a_id); it != m_channels.cend()) {
+            // Drop any pending render, fade, effect, or cue value of the channel before it is destroyed.
+            std::erase(m_render_queue, it->second.get());
+            m_fades.cancel(*it->second);
+            m_effects.remove_channel(*it->second);
+
+            for (auto& stack : m_cue_stacks) {
+                stack->remove_channel(*it->second);
+            }
+
+            m_channel_numbers.erase(it->second.get());
+            m_channels.erase(it);
+            m_output_stage_stale = true;
+            m_web_panel_interface.feed().remove_channel(a_id);
+        }
     }
 
     channel::configuration& server::channel_configuration(std::string_view const a_name) noexcept {
+        std::scoped_lock const lock(m_mutex);
+
         if (auto const it = m_configurations.find(a_name); it != m_configurations.cend()) {
             return *it->second;
         }
@@ -7,41 +7,347 @@
 namespace monet {
 
     void server::start() {
-        if (m_sink) {
-            m_sink->initialize(*this);
-        }
-
         m_running = true;
 
         m_main_thread = std::thread([&] {
-            while (m_running) poll();
+            m_frame_scheduler.reset();
+
+            while (m_running) {
+                m_frame_scheduler.wait();
+                render_frame();
+            }
         });
-    }
 
-    void server::stop() {
-        if (m_sink) {
-            m_sink->deinitialize();
+        for (auto const& output : m_sink_outputs) {
+            output->start(*this, m_frames);
         }
+    }
 
+    void server::stop() {
         m_running = false;
         m_main_thread.join();
+
+        for (auto const& output : m_sink_outputs) {
+            output->stop(m_frames);
+        }
     }
 
     // Main update function.
     void server::poll() {
-        auto current_time_point = std::chrono::high_resolution_clock::now();
-        auto time_from_last_frame = std::chrono::nanoseconds(current_time_point - m_last_frame_time);
+        render_frame();
+        output_frame();
+    }
+
+    void server::render_frame() {
+        // Channels and sinks can be changed from other threads, but never in the middle of a frame.
+        std::scoped_lock const lock(m_mutex);
+
+        auto const now = frame_scheduler::clock::now();
+
+        apply_commands();
+        m_fades.advance(now, m_render_queue);
+        m_effects.advance(now, m_render_pool, m_render_queue);
+        render_channels();
+
+        m_render_time.store((frame_scheduler::clock::now() - now).count(), std::memory_order_relaxed);
+        m_effect_time.store(m_effects.cost().count(), std::memory_order_relaxed);
+
+        auto* const snapshot = m_frames.try_acquire_write();
+
+        // Every slot is held by a sink output. Universes stay dirty and are picked up by the next frame.
+        if (!snapshot) [[unlikely]] {
+            m_dropped_frames.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        auto const configuration_revision = std::accumulate(
+            m_configurations.begin(),
+            m_configurations.end(),
+            size_t(0),
+            [] (size_t const a_total, auto const& a_configuration) {
+                return a_total + a_configuration.second->revision();
+            }
+        );
+
+        if (m_output_stage_stale || configuration_revision != m_output_stage_revision) {
+            rebuild_output_stage();
+            m_output_stage_revision = configuration_revision;
+        }
+
+        auto const universe_count = m_universes.size();
+
+        snapshot->frame_index = m_frame_index++;
+        snapshot->time = now;
+        snapshot->universe_numbers.resize(universe_count);
+        snapshot->universes.resize(universe_count);
+
+        for (size_t slot = 0; slot < universe_count; ++slot) {
+            auto& universe = m_universes.slot(slot);
+            auto const universe_number = m_universes.slot_universe(slot);
+
+            // Universes any merge source has written are output merged, others as rendered.
+            auto const* const merged = m_merge.merge(universe_number, universe);
+            auto const& merged_output = merged ? *merged : universe;
+            auto const* const transformed = m_output_stage.apply(universe_number, merged_output);
+            auto const& output = transformed ? *transformed : merged_output;
+
+            // Slot contents are left over from an earlier frame; only copy universes that changed since.
+            if (snapshot->universes[slot].generation() != output.generation()) {
+                snapshot->universes[slot] = output;
+            }
+
+            snapshot->universe_numbers[slot] = static_cast<uint16_t>(universe_number);
+            universe.clear_dirty();
+        }
+
+        m_frames.publish();
+    }
+
+    void server::apply_commands() {
+        // Apply at most one queue's worth of commands per frame so a steady flood of commands cannot stall rendering.
+        command current_command;
+
+        for (size_t i = 0; i < command_queue_capacity && m_commands.dequeue(current_command); ++i) {
+            switch (current_command.type) {
+                case command::command_type::set_attribute_value: {
+                    auto* const channel = channel_by_number(current_command.target);
+
+                    if (!channel) {
+                        break;
+                    }
+
+                    auto const attributes = channel->attributes(current_command.attribute_type);
+
+                    if (current_command.attribute_index >= attributes.size()) {
+                        break;
+                    }
+
+                    auto const& attribute = attributes[current_command.attribute_index];
+
+                    // Without a fade time the value is set now, stopping any fade running on the attribute channel.
+                    m_fades.start(
+                        *channel,
+                        *attribute,
+                        attribute->channel_name_to_id(current_command.attribute_channel),
+                        static_cast<uint16_t>(current_command.value * 257),
+                        current_command.fade_time,
+                        current_command.curve
+                    );
+
+                    mark_for_render(*channel);
+                    break;
+                }
+                case command::command_type::go_cue: {
+                    if (current_command.target < m_cue_stacks.size()) {
+                        m_cue_stacks[current_command.target]->go(m_fades, m_render_queue);
+                    }
+
+                    break;
+                }
+                case command::command_type::go_to_cue: {
+                    if (current_command.target < m_cue_stacks.size()) {
+                        m_cue_stacks[current_command.target]->go_to(current_command.cue_index, m_fades, m_render_queue);
+                    }
+
+                    break;
+                }
+                case command::command_type::set_grand_master: {
+                    m_output_stage.set_grand_master(current_command.value);
+                    break;
+                }
+                case command::command_type::set_address_value: {
+                    auto const [universe, address] = address::from_master_id(current_command.target);
+
+                    if (address::universe_table::valid(universe)) {
+                        set_address_value(universe, address, current_command.value);
+                    }
+
+                    break;
+                }
+            }
+        }
+    }
+
+    void server::render_channels() {
+        if (m_render_queue.empty()) {
+            return;
+        }
+
+        // Render each queued channel once.
+        std::sort(m_render_queue.begin(), m_render_queue.end());
+        auto const last = std::unique(m_render_queue.begin(), m_render_queue.end());
+
+        m_render_groups.resize(m_universes.size());
+
+        for (auto it = m_render_queue.begin(); it != last; ++it) {
+            auto const slot = m_universes.slot_index((*it)->universe_number());
+
+            // Unpatched channels have nothing to render.
+            if (slot == address::universe_table::npos) {
+                continue;
+            }
+
+            if (m_render_groups[slot].empty()) {
+                m_render_group_slots.push_back(slot);
+            }
+
+            m_render_groups[slot].push_back(*it);
+        }
 
-        // Time between last frame and now is more than calculated time between framerates.
-        if (time_from_last_frame.count() >= m_sink_frame_time) {
-            m_last_frame_time = current_time_point;
+        m_render_pool.run(m_render_group_slots.size(), [this] (size_t const a_index) {
+            for (auto const* const channel : m_render_groups[m_render_group_slots[a_index]]) {
+                channel->push_updates();
+            }
+        });
+
+        // Push the new values to the web panel's live feed subscribers, if there are any.
+        m_web_panel_interface.feed().capture(*this, std::span(m_render_queue.begin(), last), m_frame_index);
+
+        for (auto const slot : m_render_group_slots) {
+            m_render_groups[slot].clear();
+        }
+
+        m_render_group_slots.clear();
+        m_render_queue.clear();
+    }
+
+    void server::render_all_channels() {
+        for (auto& [channel_number, channel] : m_channels) {
+            mark_for_render(*channel);
+        }
+
+        render_channels();
+    }
+
+    void server::rebuild_output_stage() {
+        m_output_stage.clear();
+
+        for (auto const& [channel_number, channel] : m_channels) {
+            if (channel->universe_number() == 0) {
+                continue;
+            }
+
+            auto const& configuration = std::as_const(channel->config());
+            auto const& address_mappings = configuration.address_mappings();
+
+            for (size_t offset = 0; offset < address_mappings.size(); ++offset) {
+                auto const& [attribute_type, attribute_index, attribute_channel] = address_mappings[offset];
+                auto const definitions = configuration.attributes(attribute_type);
 
-            if (m_sink) {
-                for (auto& [universe_number, universe] : m_universes) {
-                    m_sink->send_universe(universe_number, *universe);
+                // Fine bytes only make sense next to their untransformed coarse byte.
+                if (attribute_index >= definitions.size() || attribute_channel.ends_with("_fine")) {
+                    continue;
                 }
+
+                m_output_stage.set_transform(
+                    channel->universe_number(),
+                    channel->address() + offset,
+                    address::output_transform::from_properties(definitions[attribute_index], attribute_type == "intensity")
+                );
             }
         }
+
+        m_output_stage_stale = false;
+    }
+
+    void server::output_frame() {
+        std::scoped_lock const lock(m_mutex);
+
+        for (auto const& output : m_sink_outputs) {
+            output->output_frame(m_frames);
+        }
+    }
+
+    void server::set_sink_interface(sink::sink* const a_sink) {
+        std::scoped_lock const lock(m_mutex);
+
+        stop_sink_outputs();
+
+        for (auto const& output : m_sink_outputs) {
+            output->release(m_frames);
+        }
+
+        m_sink_outputs.clear();
+        add_sink_output(a_sink, 0);
+        start_sink_outputs();
+    }
+
+    sink_output& server::add_sink(sink::sink* const a_sink, size_t const a_framerate) {
+        std::scoped_lock const lock(m_mutex);
+
+        stop_sink_outputs();
+        auto& output = add_sink_output(a_sink, a_framerate);
+        start_sink_outputs();
+
+        return output;
+    }
+
+    bool server::remove_sink(sink::sink const* const a_sink) {
+        std::scoped_lock const lock(m_mutex);
+
+        auto const it = std::ranges::find_if(m_sink_outputs, [a_sink] (auto const& a_output) {
+            return &std::as_const(*a_output).sink_interface() == a_sink;
+        });
+
+        if (it == m_sink_outputs.end()) {
+            return false;
+        }
+
+        // Only the removed sink output is stopped; the others keep their slots, and fewer slots are never needed.
+        if (m_running) {
+            (*it)->stop(m_frames);
+        }
+
+        (*it)->release(m_frames);
+        m_sink_outputs.erase(it);
+
+        return true;
+    }
+
+    sink_output& server::add_sink_output(sink::sink* const a_sink, size_t const a_framerate) {
+        auto& output = *m_sink_outputs.emplace_back(
+            std::make_unique<sink_output>(a_sink, a_framerate == 0 ? sink_framerate() : a_framerate)
+        );
+
+        // One slot per sink output, one for the newest snapshot, and one for the render stage to write. Slots are
+        // only ever given back by sink outputs, so every snapshot held is released before the exchange is resized.
+        for (auto const& held : m_sink_outputs) {
+            held->release(m_frames);
+        }
+
+        m_frames.resize(m_sink_outputs.size() + 2);
+
+        return output;
+    }
+
+    void server::stop_sink_outputs() {
+        if (!m_running) {
+            return;
+        }
+
+        for (auto const& output : m_sink_outputs) {
+            output->stop(m_frames);
+        }
+    }
+
+    void server::start_sink_outputs() {
+        if (!m_running) {
+            return;
+        }
+
+        for (auto const& output : m_sink_outputs) {
+            output->start(*this, m_frames);
+        }
+    }
+
+    void server::set_sink_framerate(size_t const a_framerate) noexcept {
+        std::scoped_lock const lock(m_mutex);
+
+        m_frame_scheduler.set_framerate(a_framerate);
+
+        for (auto const& output : m_sink_outputs) {
+            output->scheduler().set_framerate(a_framerate);
+        }
     }
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,491 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <optional>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <monet.hpp>
+
+namespace monet::recording {
+
+    namespace {
+
+        using universe_data = std::array<uint8_t, universe_buffer_size>;
+
+        /// Universes are encoded against this for keyframes.
+        constexpr universe_data zero_universe{};
+
+        /// The last state of a universe while encoding.
+        struct universe_state {
+            universe_data data{};
+            uint16_t address_count = 0;
+        };
+
+        /// Read a value that may not be aligned.
+        template <typename t_value>
+        t_value read(uint8_t const* const a_data) noexcept {
+            t_value value;
+            std::memcpy(&value, a_data, sizeof(value));
+            return value;
+        }
+
+        /// Append a value to a buffer.
+        template <typename t_value>
+        void append(std::vector<uint8_t>& a_buffer, t_value const& a_value) {
+            auto const* const bytes = reinterpret_cast<uint8_t const*>(&a_value);
+            a_buffer.insert(a_buffer.end(), bytes, bytes + sizeof(a_value));
+        }
+
+        /**
+         * Append the ranges of a universe that differ from a base.
+         *
+         * Changed addresses separated by fewer unchanged addresses than a range header are merged into one range, and
+         * within it, runs of show_min_run_length or more of one value are stored as a single value.
+         */
+        void encode_universe(std::vector<uint8_t>& a_buffer, universe_data const& a_data, universe_data const& a_base) {
+            size_t position = 0;
+
+            auto const append_range = [&] (size_t const a_first, size_t const a_count, bool const a_run) {
+                append(a_buffer, show_range{
+                    .skip  = static_cast<uint16_t>(a_first - position),
+                    .count = static_cast<uint16_t>(a_count | (a_run ? show_range::run : 0))
+                });
+
+                a_buffer.insert(a_buffer.end(), a_data.begin() + a_first, a_data.begin() + a_first + (a_run ? 1 : a_count));
+                position = a_first + a_count;
+            };
+
+            for (size_t first = 0; first < a_data.size();) {
+                if (a_data[first] == a_base[first]) {
+                    ++first;
+                    continue;
+                }
+
+                // Extend over changed addresses and short unchanged gaps.
+                auto last = first + 1;
+
+                for (auto next = last; next < a_data.size() && next - last < sizeof(show_range); ++next) {
+                    if (a_data[next] != a_base[next]) {
+                        last = next + 1;
+                    }
+                }
+
+                // Split into runs and the literal values between them.
+                auto literal = first;
+
+                for (auto index = first; index < last;) {
+                    auto run_end = index + 1;
+
+                    while (run_end < last && a_data[run_end] == a_data[index]) {
+                        ++run_end;
+                    }
+
+                    if (run_end - index >= show_min_run_length) {
+                        if (literal < index) {
+                            append_range(literal, index - literal, false);
+                        }
+
+                        append_range(index, run_end - index, true);
+                        literal = run_end;
+                    }
+
+                    index = run_end;
+                }
+
+                if (literal < last) {
+                    append_range(literal, last - literal, false);
+                }
+
+                first = last;
+            }
+        }
+
+        /// Copy values into a universe buffer if they differ, widening the changed range over them.
+        void apply(uint8_t* const a_buffer, size_t const a_index, uint8_t const* const a_values, size_t const a_count, std::pair<size_t, size_t>& a_changed) noexcept {
+            if (a_count > 0 && std::memcmp(a_buffer + a_index, a_values, a_count) != 0) {
+                std::memcpy(a_buffer + a_index, a_values, a_count);
+                a_changed = { std::min(a_changed.first, a_index), std::max(a_changed.second, a_index + a_count) };
+            }
+        }
+
+        /// Fill a range of a universe buffer with a value if it differs, widening the changed range over it.
+        void apply(uint8_t* const a_buffer, size_t const a_index, uint8_t const a_value, size_t const a_count, std::pair<size_t, size_t>& a_changed) noexcept {
+            auto const range = std::span(a_buffer + a_index, a_count);
+
+            if (std::ranges::any_of(range, [a_value] (uint8_t const a_current) { return a_current != a_value; })) {
+                std::ranges::fill(range, a_value);
+                a_changed = { std::min(a_changed.first, a_index), std::max(a_changed.second, a_index + a_count) };
+            }
+        }
+
+    }
+
+    bool encode_show_file(reader const& a_recording, std::filesystem::path const& a_file, std::chrono::nanoseconds const a_keyframe_interval) {
+        if (!a_recording.is_open()) {
+            return false;
+        }
+
+        std::ofstream file(a_file, std::ios::binary | std::ios::trunc);
+
+        if (!file) {
+            return false;
+        }
+
+        auto const records = a_recording.records();
+
+        show_file_header header{
+            .magic           = show_file_magic,
+            .version         = show_file_version,
+            .reserved0       = 0,
+            .start_time      = a_recording.header().start_time,
+            .duration        = records.empty() ? 0 : records.back().time,
+            .frame_count     = 0,
+            .keyframe_count  = 0,
+            .keyframe_offset = 0,
+            .reserved1       = 0
+        };
+
+        file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+
+        // Sorted by universe number, so keyframes list universes in order.
+        std::map<uint16_t, universe_state> states;
+        // The state of each universe changed by a frame, from before the frame.
+        std::map<uint16_t, universe_data> before;
+        std::vector<uint16_t> changed;
+        std::vector<show_keyframe> keyframes;
+        std::vector<uint8_t> frame;
+
+        uint64_t offset = sizeof(header);
+        std::optional<uint64_t> last_keyframe;
+
+        for (size_t first = 0; first < records.size();) {
+            auto const time = records[first].time;
+            auto last = first;
+
+            changed.clear();
+            before.clear();
+
+            // Apply the records of one recorded frame.
+            for (; last < records.size() && records[last].frame == records[first].frame; ++last) {
+                auto const& record = records[last];
+
+                if (record.index()) {
+                    continue;
+                }
+
+                auto& state = states[record.universe_number];
+
+                if (state.address_count == record.address_count && state.data == record.data) {
+                    continue;
+                }
+
+                if (before.try_emplace(record.universe_number, state.data).second) {
+                    changed.push_back(record.universe_number);
+                }
+
+                state.data = record.data;
+                state.address_count = record.address_count;
+            }
+
+            first = last;
+
+            auto const keyframe = !last_keyframe || time - *last_keyframe >= static_cast<uint64_t>(a_keyframe_interval.count());
+
+            // Frames that change nothing are left out, as playback holds the last state.
+            if (!keyframe && changed.empty()) {
+                continue;
+            }
+
+            if (keyframe) {
+                // Keyframes hold every universe seen so far.
+                changed.clear();
+
+                for (auto const& [universe_number, state] : states) {
+                    changed.push_back(universe_number);
+                }
+
+                keyframes.push_back({ .time = time, .frame = header.frame_count, .offset = offset });
+                last_keyframe = time;
+            } else {
+                std::ranges::sort(changed);
+            }
+
+            frame.assign(sizeof(show_frame_header), 0);
+
+            for (auto const universe_number : changed) {
+                auto const& state = states[universe_number];
+                auto const universe_offset = frame.size();
+
+                frame.resize(frame.size() + sizeof(show_universe_header));
+                encode_universe(frame, state.data, keyframe ? zero_universe : before.at(universe_number));
+
+                show_universe_header const universe_header{
+                    .universe_number = universe_number,
+                    .address_count   = state.address_count,
+                    .size            = static_cast<uint16_t>(frame.size() - universe_offset - sizeof(show_universe_header)),
+                    .reserved        = 0
+                };
+
+                std::memcpy(frame.data() + universe_offset, &universe_header, sizeof(universe_header));
+            }
+
+            show_frame_header const frame_header{
+                .time           = time,
+                .size           = static_cast<uint32_t>(frame.size() - sizeof(show_frame_header)),
+                .universe_count = static_cast<uint16_t>(changed.size()),
+                .keyframe       = keyframe
+            };
+
+            std::memcpy(frame.data(), &frame_header, sizeof(frame_header));
+            file.write(reinterpret_cast<char const*>(frame.data()), static_cast<std::streamsize>(frame.size()));
+
+            offset += frame.size();
+            ++header.frame_count;
+        }
+
+        // Align the keyframe index so it can be read in place.
+        constexpr std::array<char, alignof(show_keyframe)> padding{};
+        auto const padding_size = (alignof(show_keyframe) - offset % alignof(show_keyframe)) % alignof(show_keyframe);
+        file.write(padding.data(), static_cast<std::streamsize>(padding_size));
+
+        header.keyframe_count = keyframes.size();
+        header.keyframe_offset = offset + padding_size;
+
+        file.write(reinterpret_cast<char const*>(keyframes.data()), static_cast<std::streamsize>(keyframes.size() * sizeof(show_keyframe)));
+        file.seekp(0);
+        file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+
+        return static_cast<bool>(file);
+    }
+
+    show_player::show_player() noexcept :
+        m_file(-1),
+        m_mapping(nullptr),
+        m_size(0),
+        m_universes(),
+        m_offset(0),
+        m_frame(0),
+        m_time(0),
+        m_changed()
+    {}
+
+    show_player::~show_player() {
+        close();
+    }
+
+    bool show_player::open(std::filesystem::path const& a_file) {
+        close();
+
+        if ((m_file = ::open(a_file.c_str(), O_RDONLY)) < 0) {
+            return false;
+        }
+
+        struct stat file_status{};
+
+        if (fstat(m_file, &file_status) < 0 || static_cast<size_t>(file_status.st_size) < sizeof(show_file_header)) {
+            close();
+            return false;
+        }
+
+        m_size = static_cast<size_t>(file_status.st_size);
+        m_mapping = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, m_file, 0);
+
+        if (m_mapping == MAP_FAILED) {
+            m_mapping = nullptr;
+            close();
+            return false;
+        }
+
+        auto const& file = header();
+
+        if (file.magic != show_file_magic || file.version != show_file_version || file.keyframe_offset > m_size ||
+            file.keyframe_offset % alignof(show_keyframe) != 0 ||
+            file.keyframe_count > (m_size - file.keyframe_offset) / sizeof(show_keyframe)) {
+            close();
+            return false;
+        }
+
+        // Sequential playback reads ahead; seeking jumps to keyframes.
+        madvise(m_mapping, m_size, MADV_SEQUENTIAL);
+
+        rewind();
+        return true;
+    }
+
+    void show_player::close() noexcept {
+        if (m_mapping) {
+            munmap(m_mapping, m_size);
+            m_mapping = nullptr;
+        }
+
+        if (m_file >= 0) {
+            ::close(m_file);
+            m_file = -1;
+        }
+
+        m_size = 0;
+        m_offset = 0;
+        m_frame = 0;
+        m_time = 0;
+        m_changed.clear();
+    }
+
+    std::span<show_keyframe const> show_player::keyframes() const noexcept {
+        if (!m_mapping) {
+            return {};
+        }
+
+        return { reinterpret_cast<show_keyframe const*>(at(header().keyframe_offset)), header().keyframe_count };
+    }
+
+    std::chrono::nanoseconds show_player::next_time() const noexcept {
+        if (finished() || m_offset + sizeof(show_frame_header) > header().keyframe_offset) {
+            return time();
+        }
+
+        return std::chrono::nanoseconds(read<show_frame_header>(at(m_offset)).time);
+    }
+
+    bool show_player::next_frame() {
+        if (finished()) {
+            return false;
+        }
+
+        auto const end = header().keyframe_offset;
+
+        if (m_offset + sizeof(show_frame_header) > end ||
+            m_offset + sizeof(show_frame_header) + read<show_frame_header>(at(m_offset)).size > end) {
+            return false;
+        }
+
+        decode_frame(m_offset);
+        return true;
+    }
+
+    void show_player::seek(std::chrono::nanoseconds const a_time) {
+        if (!m_mapping) {
+            return;
+        }
+
+        auto const time = static_cast<uint64_t>(std::max<int64_t>(a_time.count(), 0));
+        auto const index = keyframes();
+
+        // Last keyframe at or before the time, or the first if the time is before it.
+        auto keyframe = std::ranges::upper_bound(index, time, std::less{}, &show_keyframe::time);
+
+        if (keyframe != index.begin()) {
+            --keyframe;
+        }
+
+        rewind();
+
+        if (keyframe != index.end()) {
+            m_offset = keyframe->offset;
+            m_frame = keyframe->frame;
+        }
+
+        if (next_frame()) {
+            while (!finished() && static_cast<uint64_t>(next_time().count()) <= time && next_frame()) {}
+        }
+
+        // Everything may have changed.
+        m_changed.clear();
+
+        for (auto [universe_number, universe] : m_universes) {
+            universe.mark_dirty(0, universe_buffer_size);
+            m_changed.push_back(universe_number);
+        }
+    }
+
+    void show_player::decode_frame(size_t const a_offset) {
+        auto const frame = read<show_frame_header>(at(a_offset));
+        auto const* data = at(a_offset + sizeof(show_frame_header));
+        auto const* const frame_end = data + frame.size;
+
+        m_changed.clear();
+
+        for (size_t i = 0; i < frame.universe_count && data + sizeof(show_universe_header) <= frame_end; ++i) {
+            auto const universe_header = read<show_universe_header>(data);
+            data += sizeof(show_universe_header);
+
+            auto const* const end = std::min(data + universe_header.size, frame_end);
+
+            if (!address::universe_table::valid(universe_header.universe_number)) {
+                data = end;
+                continue;
+            }
+
+            auto& universe = m_universes.create(universe_header.universe_number);
+            auto* const buffer = universe.buffer();
+            std::pair<size_t, size_t> changed{ universe_buffer_size, 0 };
+            size_t position = 0;
+
+            // Values are written straight from the mapping into the universe.
+            while (data + sizeof(show_range) <= end) {
+                auto const range = read<show_range>(data);
+                data += sizeof(show_range);
+
+                auto const run = (range.count & show_range::run) != 0;
+                auto const first = position + range.skip;
+                auto const count = static_cast<size_t>(range.count & ~show_range::run);
+
+                if (first + count > universe_buffer_size || data + (run ? 1 : count) > end) [[unlikely]] {
+                    break;
+                }
+
+                // Keyframes are encoded against zeros.
+                if (frame.keyframe) {
+                    apply(buffer, position, uint8_t{0}, range.skip, changed);
+                }
+
+                if (run) {
+                    apply(buffer, first, *data, count, changed);
+                    data += 1;
+                } else {
+                    apply(buffer, first, data, count, changed);
+                    data += count;
+                }
+
+                position = first + count;
+            }
+
+            if (frame.keyframe) {
+                apply(buffer, position, uint8_t{0}, universe_buffer_size - position, changed);
+            }
+
+            data = end;
+
+            if (changed.first < changed.second || universe.address_count() != universe_header.address_count) {
+                universe.mark_dirty(changed.first, changed.second);
+                universe.set_address_count(universe_header.address_count);
+                m_changed.push_back(universe_header.universe_number);
+            }
+        }
+
+        m_offset = a_offset + sizeof(show_frame_header) + frame.size;
+        m_time = frame.time;
+        ++m_frame;
+    }
+
+    void show_player::rewind() {
+        for (auto [universe_number, universe] : m_universes) {
+            std::memset(universe.buffer(), 0, universe_buffer_size);
+            universe.set_address_count(0);
+        }
+
+        m_offset = sizeof(show_file_header);
+        m_frame = 0;
+        m_time = 0;
+        m_changed.clear();
+    }
+
+}
@@ -0,0 +1,380 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <algorithm>
+#include <cstring>
+
+#include <monet.hpp>
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <unistd.h>
+#endif
+
+namespace monet::sink {
+
+    namespace {
+
+        constexpr std::array<uint8_t, 8> artnet_id{ 'A', 'r', 't', '-', 'N', 'e', 't', 0 };
+        constexpr uint16_t artnet_protocol_version = 14;
+
+        constexpr uint16_t op_poll       = 0x2000;
+        constexpr uint16_t op_poll_reply = 0x2100;
+        constexpr uint16_t op_dmx        = 0x5000;
+        constexpr uint16_t op_sync       = 0x5200;
+
+        /// Offsets into an ArtPollReply.
+        constexpr size_t poll_reply_net_switch  = 18;
+        constexpr size_t poll_reply_sub_switch  = 19;
+        constexpr size_t poll_reply_port_count  = 173;
+        constexpr size_t poll_reply_port_types  = 174;
+        constexpr size_t poll_reply_sw_out      = 190;
+        constexpr size_t poll_reply_min_size    = 207;
+
+        /// Write the ID, little endian op code, and big endian protocol version common to every Art-Net packet.
+        void write_header(std::span<uint8_t> const a_packet, uint16_t const a_op_code) noexcept {
+            std::ranges::copy(artnet_id, a_packet.begin());
+            a_packet[8]  = static_cast<uint8_t>(a_op_code & 0xFF);
+            a_packet[9]  = static_cast<uint8_t>(a_op_code >> 8);
+            a_packet[10] = static_cast<uint8_t>(artnet_protocol_version >> 8);
+            a_packet[11] = static_cast<uint8_t>(artnet_protocol_version & 0xFF);
+        }
+
+        /// Get the op code of a received packet, or 0 if it is not Art-Net.
+        uint16_t read_op_code(std::span<uint8_t const> const a_packet) noexcept {
+            if (a_packet.size() < 10 || !std::equal(artnet_id.begin(), artnet_id.end(), a_packet.begin())) {
+                return 0;
+            }
+
+            return static_cast<uint16_t>(a_packet[8] | a_packet[9] << 8);
+        }
+
+        /// Collect the indices of the nodes outputting a port address.
+        void find_destinations(std::span<artnet::node const> const a_nodes, uint16_t const a_port, std::vector<size_t>& a_destinations) {
+            a_destinations.clear();
+
+            for (size_t node_index = 0; node_index < a_nodes.size(); ++node_index) {
+                if (std::ranges::find(a_nodes[node_index].port_addresses, a_port) != a_nodes[node_index].port_addresses.end()) {
+                    a_destinations.push_back(node_index);
+                }
+            }
+        }
+
+    }
+
+    artnet::artnet(std::string a_broadcast_host, uint16_t const a_port) noexcept :
+        sink("artnet"),
+        m_socket_id(-1),
+        m_port(a_port),
+        m_broadcast_host(std::move(a_broadcast_host)),
+        m_broadcast_address(),
+        m_discovery(true),
+        m_sync(true),
+        m_nodes(),
+        m_nodes_revision(0),
+        m_destinations_revision(0),
+        m_last_poll(),
+        m_packets(),
+        m_sync_packet(),
+        m_poll_packet(),
+        m_reply_buffer(),
+        m_frame_packets(),
+        m_send_errors(0)
+    {
+        write_header(m_sync_packet, op_sync);
+        write_header(m_poll_packet, op_poll);
+
+        // Ask nodes to reply whenever their state changes, not only when polled.
+        m_poll_packet[12] = 0x02;
+    }
+
+    bool artnet::initialize(server& a_server) {
+        if ((m_socket_id = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP)) < 0) {
+            return false;
+        }
+
+        int const enable = 1;
+        setsockopt(m_socket_id, SOL_SOCKET, SO_BROADCAST, &enable, sizeof(enable));
+        setsockopt(m_socket_id, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+        // Nodes send ArtPollReply to the Art-Net port. Without it, output still works without discovery.
+        sockaddr_in local{};
+        local.sin_family = AF_INET;
+        local.sin_addr.s_addr = htonl(INADDR_ANY);
+        local.sin_port = htons(m_port);
+        bind(m_socket_id, reinterpret_cast<sockaddr const*>(&local), sizeof(local));
+
+        m_broadcast_address = {};
+
+        if (!m_broadcast_host.empty()) {
+            m_broadcast_address.sin_family = AF_INET;
+            m_broadcast_address.sin_port = htons(m_port);
+
+            if (inet_pton(AF_INET, m_broadcast_host.c_str(), &m_broadcast_address.sin_addr) != 1) {
+                return false;
+            }
+        }
+
+        m_last_poll = {};
+
+        return true;
+    }
+
+    void artnet::deinitialize() {
+        if (m_socket_id >= 0) {
+            close(m_socket_id);
+            m_socket_id = -1;
+        }
+    }
+
+    bool artnet::add_node(std::string const& a_host, std::vector<uint16_t> a_port_addresses) {
+        node new_node{ .port_addresses = std::move(a_port_addresses), .manual = true };
+        new_node.address.sin_family = AF_INET;
+        new_node.address.sin_port = htons(m_port);
+
+        if (inet_pton(AF_INET, a_host.c_str(), &new_node.address.sin_addr) != 1) {
+            return false;
+        }
+
+        m_nodes.push_back(std::move(new_node));
+        ++m_nodes_revision;
+
+        return true;
+    }
+
+    void artnet::send_universe(size_t const a_universe_number, address::universe const& a_universe) {
+        frame_universe const universe{ a_universe_number, &a_universe };
+        send_frame(std::span(&universe, 1));
+    }
+
+    void artnet::send_frame(std::span<frame_universe const> const a_universes) {
+        if (m_discovery) {
+            discover_nodes(clock::now());
+        }
+
+        if (m_destinations_revision != m_nodes_revision) {
+            resolve_destinations();
+        }
+
+        m_frame_packets.clear();
+
+        for (auto const& [universe_number, universe] : a_universes) {
+            m_frame_packets.push_back(&prepare_packet(universe_number, *universe));
+        }
+
+#if defined(__linux__)
+        m_frame_messages.clear();
+        m_frame_buffers.clear();
+
+        m_frame_buffers.reserve(m_frame_packets.size() * 2);
+
+        // Every destination of a packet shares its buffers, and the data buffer points into the universe.
+        for (auto* const packet : m_frame_packets) {
+            auto& buffer = m_frame_buffers.emplace_back(iovec{ .iov_base = packet->header.data(), .iov_len = packet->header.size() });
+            m_frame_buffers.push_back({ .iov_base = const_cast<uint8_t*>(packet->data), .iov_len = packet->length });
+
+            auto const add_message = [&] (sockaddr_in& a_address) {
+                auto& message = m_frame_messages.emplace_back();
+                message.msg_hdr.msg_name    = &a_address;
+                message.msg_hdr.msg_namelen = sizeof(a_address);
+                message.msg_hdr.msg_iov     = &buffer;
+                message.msg_hdr.msg_iovlen  = 2;
+            };
+
+            if (packet->destinations.empty()) {
+                if (m_broadcast_address.sin_family == AF_INET) {
+                    add_message(m_broadcast_address);
+                }
+            } else {
+                for (auto const node_index : packet->destinations) {
+                    add_message(m_nodes[node_index].address);
+                }
+            }
+        }
+
+        // sendmmsg() may send fewer messages than requested; resume from the first unsent one. It fails only when the
+        // first message fails, which is then skipped so one unreachable node does not drop the rest of the frame.
+        for (size_t sent = 0; sent < m_frame_messages.size();) {
+            auto const result = sendmmsg(
+                m_socket_id,
+                m_frame_messages.data() + sent,
+                static_cast<unsigned int>(m_frame_messages.size() - sent),
+                0
+            );
+
+            if (result <= 0) {
+                m_send_errors.fetch_add(1, std::memory_order_relaxed);
+                sent += 1;
+                continue;
+            }
+
+            sent += result;
+        }
+#else
+        for (auto* const packet : m_frame_packets) {
+            auto const size = dmx_header_size + packet->length;
+
+            std::ranges::copy(packet->header, m_send_buffer.begin());
+            std::memcpy(m_send_buffer.data() + dmx_header_size, packet->data, packet->length);
+
+            if (packet->destinations.empty()) {
+                if (m_broadcast_address.sin_family == AF_INET) {
+                    send_to(m_send_buffer.data(), size, m_broadcast_address);
+                }
+            } else {
+                for (auto const node_index : packet->destinations) {
+                    send_to(m_send_buffer.data(), size, m_nodes[node_index].address);
+                }
+            }
+        }
+#endif
+
+        if (m_sync && !m_frame_packets.empty()) {
+            send_to_all(m_sync_packet);
+        }
+    }
+
+    artnet::universe_packet& artnet::prepare_packet(size_t const a_universe_number, address::universe const& a_universe) {
+        auto& packet = m_packets[a_universe_number];
+
+        if (!packet) {
+            packet = std::make_unique<universe_packet>();
+
+            auto const port = port_address(a_universe_number);
+
+            write_header(packet->header, op_dmx);
+            // Sequence (12) and physical port (13) follow, then the port address, low byte first.
+            packet->header[14] = static_cast<uint8_t>(port & 0xFF);
+            packet->header[15] = static_cast<uint8_t>(port >> 8);
+
+            find_destinations(m_nodes, port, packet->destinations);
+        }
+
+        // The data length must be even and at least 2. Rounding up stays within the 512 address buffer.
+        auto const count = std::min(dmx_data_channel_count, a_universe.address_count() > 0 ? a_universe.address_count() - 1 : 0);
+        auto const length = std::max<size_t>(2, (count + 1) & ~size_t(1));
+
+        // Sequence numbers run from 1 to 255; 0 would turn resequencing off on the node.
+        packet->header[12] = packet->header[12] == 255 ? 1 : packet->header[12] + 1;
+        packet->header[16] = static_cast<uint8_t>(length >> 8);
+        packet->header[17] = static_cast<uint8_t>(length & 0xFF);
+
+        packet->data = a_universe.buffer() + 1;
+        packet->length = length;
+
+        return *packet;
+    }
+
+    void artnet::resolve_destinations() {
+        for (auto& [universe_number, packet] : m_packets) {
+            find_destinations(m_nodes, port_address(universe_number), packet->destinations);
+        }
+
+        m_destinations_revision = m_nodes_revision;
+    }
+
+    void artnet::discover_nodes(clock::time_point const a_now) {
+        if (m_socket_id < 0) {
+            return;
+        }
+
+        sockaddr_in sender{};
+        socklen_t sender_size = sizeof(sender);
+
+        // Take in every reply that has arrived since the last frame without blocking.
+        for (ssize_t received; (received = recvfrom(m_socket_id, m_reply_buffer.data(), m_reply_buffer.size(), MSG_DONTWAIT, reinterpret_cast<sockaddr*>(&sender), &sender_size)) > 0; sender_size = sizeof(sender)) {
+            auto const reply = std::span<uint8_t const>(m_reply_buffer.data(), static_cast<size_t>(received));
+
+            if (read_op_code(reply) == op_poll_reply) {
+                process_poll_reply(reply, sender, a_now);
+            }
+        }
+
+        // Forget discovered nodes that stopped answering.
+        auto const expired = std::erase_if(m_nodes, [&] (node const& a_node) {
+            return !a_node.manual && a_now - a_node.last_seen > artnet_node_timeout;
+        });
+
+        if (expired > 0) {
+            ++m_nodes_revision;
+        }
+
+        if (a_now - m_last_poll >= artnet_poll_interval && m_broadcast_address.sin_family == AF_INET) {
+            sendto(m_socket_id, m_poll_packet.data(), m_poll_packet.size(), 0, reinterpret_cast<sockaddr const*>(&m_broadcast_address), sizeof(m_broadcast_address));
+            m_last_poll = a_now;
+        }
+    }
+
+    void artnet::process_poll_reply(std::span<uint8_t const> const a_reply, sockaddr_in const& a_sender, clock::time_point const a_now) {
+        if (a_reply.size() < poll_reply_min_size) {
+            return;
+        }
+
+        std::vector<uint16_t> port_addresses;
+        auto const port_count = std::min<size_t>(a_reply[poll_reply_port_count], 4);
+
+        for (size_t port = 0; port < port_count; ++port) {
+            // Bit 7 of the port type is set for ports that output Art-Net data.
+            if (a_reply[poll_reply_port_types + port] & 0x80) {
+                port_addresses.push_back(static_cast<uint16_t>(
+                    (a_reply[poll_reply_net_switch] & 0x7F) << 8 |
+                    (a_reply[poll_reply_sub_switch] & 0x0F) << 4 |
+                    (a_reply[poll_reply_sw_out + port] & 0x0F)
+                ));
+            }
+        }
+
+        auto const it = std::ranges::find_if(m_nodes, [&] (node const& a_node) {
+            return !a_node.manual && a_node.address.sin_addr.s_addr == a_sender.sin_addr.s_addr;
+        });
+
+        if (it == m_nodes.end()) {
+            node new_node{ .address = a_sender, .port_addresses = std::move(port_addresses), .last_seen = a_now };
+            new_node.address.sin_port = htons(m_port);
+
+            m_nodes.push_back(std::move(new_node));
+            ++m_nodes_revision;
+        } else {
+            // A node with several port pages replies once per page; keep the ports of every page.
+            for (auto const port : port_addresses) {
+                if (std::ranges::find(it->port_addresses, port) == it->port_addresses.end()) {
+                    it->port_addresses.push_back(port);
+                    ++m_nodes_revision;
+                }
+            }
+
+            it->last_seen = a_now;
+        }
+    }
+
+    void artnet::send_to_all(std::span<uint8_t const> const a_packet) {
+        auto broadcast = false;
+
+        for (auto const* const packet : m_frame_packets) {
+            broadcast |= packet->destinations.empty();
+        }
+
+        if (broadcast && m_broadcast_address.sin_family == AF_INET) {
+            send_to(a_packet.data(), a_packet.size(), m_broadcast_address);
+        }
+
+        // Unicast to every node that was sent data this frame, once each.
+        for (size_t node_index = 0; node_index < m_nodes.size(); ++node_index) {
+            auto const used = std::ranges::any_of(m_frame_packets, [&] (universe_packet const* const a_packet) {
+                return std::ranges::find(a_packet->destinations, node_index) != a_packet->destinations.end();
+            });
+
+            if (used) {
+                send_to(a_packet.data(), a_packet.size(), m_nodes[node_index].address);
+            }
+        }
+    }
+
+    void artnet::send_to(void const* const a_data, size_t const a_size, sockaddr_in const& a_address) {
+        if (sendto(m_socket_id, static_cast<char const*>(a_data), a_size, 0, reinterpret_cast<sockaddr const*>(&a_address), sizeof(a_address)) < 0) {
+            m_send_errors.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+}
@@ -0,0 +1,350 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <csignal>
+#include <new>
+#include <thread>
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include <monet.hpp>
+
+namespace monet::sink {
+
+    namespace {
+
+        /// Current steady clock time in nanoseconds, as stored in the heartbeat.
+        int64_t now_nanoseconds() noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(sink::clock::now().time_since_epoch()).count();
+        }
+
+        /// Wait until a value shared between processes no longer holds an expected value, or for a timeout.
+        void wait_for_change(std::atomic<uint32_t>& a_value, uint32_t const a_expected, std::chrono::nanoseconds const a_timeout) noexcept {
+#if defined(__linux__)
+            timespec const timeout{
+                .tv_sec  = static_cast<time_t>(a_timeout.count() / 1000000000),
+                .tv_nsec = static_cast<long>(a_timeout.count() % 1000000000)
+            };
+
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&a_value), FUTEX_WAIT, a_expected, &timeout, nullptr, 0);
+#else
+            for (auto const deadline = sink::clock::now() + a_timeout; a_value.load(std::memory_order_acquire) == a_expected && sink::clock::now() < deadline;) {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+#endif
+        }
+
+        /// Wake the process waiting on a value shared between processes.
+        void wake(std::atomic<uint32_t>& a_value) noexcept {
+#if defined(__linux__)
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&a_value), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+#endif
+        }
+
+    }
+
+    process_host::process_host(factory a_factory, size_t const a_universe_capacity, clock::duration const a_stall_timeout) noexcept :
+        sink("process_host"),
+        m_factory(std::move(a_factory)),
+        m_requested_universe_capacity(a_universe_capacity),
+        m_universe_capacity(a_universe_capacity),
+        m_stall_timeout(a_stall_timeout),
+        m_server(nullptr),
+        m_mapping(nullptr),
+        m_mapping_size(0),
+        m_slot_size(sizeof(ring_slot) + a_universe_capacity * sizeof(ring_universe)),
+        m_child(0),
+        m_child_started(),
+        m_restart_delay(clock::duration::zero()),
+        m_restart_time(),
+        m_restarts(0),
+        m_dropped_frames(0)
+    {
+        static_assert(std::atomic<uint32_t>::is_always_lock_free && std::atomic<int64_t>::is_always_lock_free);
+    }
+
+    process_host::~process_host() {
+        process_host::deinitialize();
+    }
+
+    bool process_host::initialize(server& a_server) {
+        deinitialize();
+
+        m_server = &a_server;
+        m_universe_capacity = std::max(m_requested_universe_capacity, a_server.universes().size());
+        m_slot_size = sizeof(ring_slot) + m_universe_capacity * sizeof(ring_universe);
+        m_mapping_size = sizeof(ring_control) + process_host_ring_slots * m_slot_size;
+        m_restart_delay = clock::duration::zero();
+
+        // Anonymous, so only the child forked from this process shares it.
+        m_mapping = mmap(nullptr, m_mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+        if (m_mapping == MAP_FAILED) {
+            m_mapping = nullptr;
+            return false;
+        }
+
+        new (m_mapping) ring_control{};
+
+        // The ring is kept, so supervise() retries a sink whose device is not ready yet, backing off while it fails.
+        if (!start_child() || !wait_for_child(process_host_start_timeout)) {
+            stop_child(clock::duration::zero());
+            m_restart_delay = process_host_min_restart_delay;
+            m_restart_time = clock::now() + m_restart_delay;
+            return false;
+        }
+
+        return true;
+    }
+
+    void process_host::deinitialize() {
+        if (!m_mapping) {
+            return;
+        }
+
+        control().stop.store(1, std::memory_order_release);
+        wake(control().published);
+        stop_child(process_host_stop_timeout);
+
+        munmap(m_mapping, m_mapping_size);
+        m_mapping = nullptr;
+    }
+
+    void process_host::send_universe(size_t const a_universe_number, address::universe const& a_universe) {
+        frame_universe const universe{ a_universe_number, &a_universe };
+        send_frame(std::span(&universe, 1));
+    }
+
+    void process_host::send_frame(std::span<frame_universe const> const a_universes) {
+        if (!m_mapping) {
+            return;
+        }
+
+        supervise();
+
+        auto& ring = control();
+        auto const published = ring.published.load(std::memory_order_relaxed);
+
+        // Never wait for the child; while it is behind or restarting, the ring fills and further frames are dropped.
+        if (published - ring.consumed.load(std::memory_order_acquire) >= process_host_ring_slots) {
+            m_dropped_frames.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        auto& slot = slot_at(published);
+        auto* const universes = slot_universes(slot);
+        auto const count = std::min(a_universes.size(), m_universe_capacity);
+
+        if (count < a_universes.size()) [[unlikely]] {
+            m_dropped_frames.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            universes[i].number = a_universes[i].number;
+            universes[i].universe = *a_universes[i].universe;
+        }
+
+        slot.universe_count = count;
+
+        // Only the index is signaled; the child reads the universes where they are.
+        ring.published.store(published + 1, std::memory_order_release);
+        wake(ring.published);
+    }
+
+    void process_host::supervise() {
+        if (!m_mapping) {
+            return;
+        }
+
+        auto& ring = control();
+        auto exited = false;
+
+        if (m_child > 0) {
+            int status = 0;
+            exited = waitpid(m_child, &status, WNOHANG) == m_child;
+
+            if (exited) {
+                m_child = 0;
+            } else if (clock::now().time_since_epoch() - std::chrono::nanoseconds(ring.heartbeat.load(std::memory_order_acquire)) > m_stall_timeout) {
+                // Stuck in the sink; it will not notice a stop request either.
+                stop_child(clock::duration::zero());
+                exited = true;
+            }
+        }
+
+        if (m_child > 0) {
+            return;
+        }
+
+        if (exited) {
+            // Skip the frame the child died sending, in case it is what killed it.
+            auto const consumed = ring.consumed.load(std::memory_order_acquire);
+            auto const sending = ring.sending.load(std::memory_order_acquire);
+
+            if (sending != consumed) {
+                ring.consumed.store(sending, std::memory_order_release);
+                m_dropped_frames.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            // A child that ran for a while restarts right away; one that keeps failing soon after starting backs off.
+            auto const now = clock::now();
+            auto const healthy = now - m_child_started >= process_host_max_restart_delay;
+
+            m_restart_delay = healthy ? clock::duration::zero() : std::clamp<clock::duration>(m_restart_delay * 2, process_host_min_restart_delay, process_host_max_restart_delay);
+            m_restart_time = now + m_restart_delay;
+        }
+
+        if (clock::now() < m_restart_time) {
+            return;
+        }
+
+        if (start_child()) {
+            m_restarts.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    size_t process_host::pending_frames() const noexcept {
+        if (!m_mapping) {
+            return 0;
+        }
+
+        return control().published.load(std::memory_order_acquire) - control().consumed.load(std::memory_order_acquire);
+    }
+
+    bool process_host::start_child() {
+        auto& ring = control();
+        ring.sending.store(ring.consumed.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        ring.state.store(starting, std::memory_order_relaxed);
+        ring.heartbeat.store(now_nanoseconds(), std::memory_order_release);
+
+        auto const child = fork();
+
+        if (child < 0) {
+            return false;
+        }
+
+        if (child == 0) {
+            run_child();
+        }
+
+        m_child = child;
+        m_child_started = clock::now();
+        return true;
+    }
+
+    bool process_host::wait_for_child(clock::duration const a_timeout) {
+        auto& ring = control();
+
+        for (auto const deadline = clock::now() + a_timeout; clock::now() < deadline;) {
+            auto const state = ring.state.load(std::memory_order_acquire);
+
+            if (state != starting) {
+                return state == ready;
+            }
+
+            int status = 0;
+
+            if (waitpid(m_child, &status, WNOHANG) == m_child) {
+                m_child = 0;
+                return false;
+            }
+
+            wait_for_change(ring.state, starting, std::chrono::milliseconds(10));
+        }
+
+        return false;
+    }
+
+    void process_host::stop_child(clock::duration const a_timeout) {
+        if (m_child <= 0) {
+            return;
+        }
+
+        int status = 0;
+
+        for (auto const deadline = clock::now() + a_timeout; clock::now() < deadline; std::this_thread::sleep_for(std::chrono::milliseconds(1))) {
+            if (waitpid(m_child, &status, WNOHANG) == m_child) {
+                m_child = 0;
+                return;
+            }
+        }
+
+        kill(m_child, SIGKILL);
+        waitpid(m_child, &status, 0);
+        m_child = 0;
+    }
+
+    void process_host::run_child() {
+#if defined(__linux__)
+        // Do not outlive the server.
+        prctl(PR_SET_PDEATHSIG, SIGKILL);
+#endif
+
+        auto& ring = control();
+
+        // Nothing may unwind out of here, into the copy of the server's stack.
+        try {
+            auto hosted = m_factory ? m_factory() : nullptr;
+
+            if (!hosted || !hosted->initialize(*m_server)) {
+                ring.state.store(failed, std::memory_order_release);
+                wake(ring.state);
+                _exit(EXIT_FAILURE);
+            }
+
+            ring.state.store(ready, std::memory_order_release);
+            wake(ring.state);
+
+            send_frames(*hosted);
+            hosted->deinitialize();
+        } catch (...) {
+            ring.state.store(failed, std::memory_order_release);
+            wake(ring.state);
+            _exit(EXIT_FAILURE);
+        }
+
+        _exit(EXIT_SUCCESS);
+    }
+
+    void process_host::send_frames(sink& a_hosted) {
+        auto& ring = control();
+
+        std::vector<frame_universe> frame;
+        frame.reserve(m_universe_capacity);
+
+        while (!ring.stop.load(std::memory_order_acquire)) {
+            ring.heartbeat.store(now_nanoseconds(), std::memory_order_release);
+
+            auto const consumed = ring.consumed.load(std::memory_order_relaxed);
+            auto const published = ring.published.load(std::memory_order_acquire);
+
+            if (consumed == published) {
+                wait_for_change(ring.published, published, process_host_heartbeat_interval);
+                continue;
+            }
+
+            auto& slot = slot_at(consumed);
+            auto* const universes = slot_universes(slot);
+
+            frame.clear();
+
+            for (size_t i = 0; i < slot.universe_count; ++i) {
+                frame.push_back({ universes[i].number, &universes[i].universe });
+            }
+
+            ring.sending.store(consumed + 1, std::memory_order_release);
+            a_hosted.send_frame(frame);
+            ring.consumed.store(consumed + 1, std::memory_order_release);
+        }
+    }
+
+}
@@ -0,0 +1,189 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <atomic>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <monet.hpp>
+
+namespace monet::sink {
+
+    namespace {
+
+        /// Size of a recording file holding an amount of records.
+        constexpr size_t file_size(size_t const a_record_count) noexcept {
+            return sizeof(recording::file_header) + a_record_count * sizeof(recording::record);
+        }
+
+    }
+
+    recorder::recorder(std::filesystem::path a_path, clock::duration const a_index_interval) noexcept :
+        sink("recorder"),
+        m_path(std::move(a_path)),
+        m_index_interval(a_index_interval),
+        m_file(-1),
+        m_mapping(nullptr),
+        m_capacity(0),
+        m_record_count(0),
+        m_frame_count(0),
+        m_full(false),
+        m_start_time(),
+        m_last_index(),
+        m_index_due(true)
+    {
+        set_unchanged_repeats(0);
+    }
+
+    recorder::~recorder() {
+        recorder::deinitialize();
+    }
+
+    bool recorder::initialize(server& a_server) {
+        deinitialize();
+
+        if ((m_file = ::open(m_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644)) < 0) {
+            return false;
+        }
+
+        m_record_count = 0;
+        m_frame_count = 0;
+        m_full = false;
+
+        if (!map(recording_growth_records)) {
+            deinitialize();
+            return false;
+        }
+
+        header() = {
+            .magic          = recording::file_magic,
+            .version        = recording::file_version,
+            .record_size    = sizeof(recording::record),
+            .start_time     = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count(),
+            .index_interval = std::chrono::duration_cast<std::chrono::nanoseconds>(m_index_interval).count(),
+            .record_count   = 0,
+            .frame_count    = 0,
+            .reserved       = {}
+        };
+
+        m_start_time = clock::now();
+
+        // The first frame records every universe.
+        reset_output_states();
+        m_index_due = true;
+
+        return true;
+    }
+
+    void recorder::deinitialize() {
+        if (m_mapping) {
+            munmap(m_mapping, file_size(m_capacity));
+            m_mapping = nullptr;
+            m_capacity = 0;
+        }
+
+        if (m_file >= 0) {
+            // Drop the space reserved beyond the last record.
+            ftruncate(m_file, static_cast<off_t>(file_size(m_record_count)));
+            ::close(m_file);
+            m_file = -1;
+        }
+    }
+
+    void recorder::send_universe(size_t const a_universe_number, address::universe const& a_universe) {
+        frame_universe const universe{ a_universe_number, &a_universe };
+        send_frame(std::span(&universe, 1));
+    }
+
+    void recorder::send_frame(std::span<frame_universe const> const a_universes) {
+        auto const index = m_index_due;
+
+        if (!m_mapping || !reserve(a_universes.size() + (index ? 1 : 0))) {
+            return;
+        }
+
+        auto const now = clock::now();
+        auto const time = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_start_time).count());
+        auto const frame = static_cast<uint32_t>(m_frame_count);
+
+        if (index) {
+            auto& entry = record_at(m_record_count++);
+            entry.time = time;
+            entry.frame = frame;
+            entry.universe_number = 0;
+            entry.address_count = static_cast<uint16_t>(a_universes.size());
+
+            m_index_due = false;
+            m_last_index = now;
+        }
+
+        for (auto const& [universe_number, universe] : a_universes) {
+            auto& universe_record = record_at(m_record_count++);
+            universe_record.time = time;
+            universe_record.frame = frame;
+            universe_record.universe_number = static_cast<uint16_t>(universe_number);
+            universe_record.address_count = static_cast<uint16_t>(std::min(universe->address_count(), universe_buffer_size));
+
+            std::memcpy(universe_record.data.data(), universe->buffer(), universe_buffer_size);
+        }
+
+        ++m_frame_count;
+
+        // Publish the frame to readers only once its records are complete.
+        std::atomic_ref(header().frame_count).store(m_frame_count, std::memory_order_relaxed);
+        std::atomic_ref(header().record_count).store(m_record_count, std::memory_order_release);
+
+        // Make the next frame a keyframe.
+        if (now - m_last_index >= m_index_interval) {
+            reset_output_states();
+            m_index_due = true;
+        }
+    }
+
+    bool recorder::reserve(size_t const a_count) {
+        if (m_record_count + a_count <= m_capacity) [[likely]] {
+            return true;
+        }
+
+        if (m_full || !map(m_capacity + std::max(recording_growth_records, a_count))) {
+            m_full = true;
+            return false;
+        }
+
+        return true;
+    }
+
+    bool recorder::map(size_t const a_capacity) {
+        if (ftruncate(m_file, static_cast<off_t>(file_size(a_capacity))) < 0) {
+            return false;
+        }
+
+        void* mapping;
+
+        if (m_mapping) {
+#if defined(__linux__)
+            mapping = mremap(m_mapping, file_size(m_capacity), file_size(a_capacity), MREMAP_MAYMOVE);
+#else
+            munmap(m_mapping, file_size(m_capacity));
+            m_mapping = nullptr;
+            mapping = mmap(nullptr, file_size(a_capacity), PROT_READ | PROT_WRITE, MAP_SHARED, m_file, 0);
+#endif
+        } else {
+            mapping = mmap(nullptr, file_size(a_capacity), PROT_READ | PROT_WRITE, MAP_SHARED, m_file, 0);
+        }
+
+        if (mapping == MAP_FAILED) {
+            return false;
+        }
+
+        m_mapping = mapping;
+        m_capacity = a_capacity;
+
+        return true;
+    }
+
+}
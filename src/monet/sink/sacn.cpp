@@ -4,6 +4,10 @@
 
 #include <monet.hpp>
 
+#if defined(__linux__)
+#include <arpa/inet.h>
+#endif
+
 namespace monet::sink {
 
     bool sacn::initialize(server& a_server) {
@@ -25,16 +29,96 @@ namespace monet::sink {
     }
 
     void sacn::send_universe(size_t const a_universe_number, address::universe const& a_universe) {
+        auto& [addr, packet] = prepare_packet(a_universe_number, a_universe);
+
+        if (e131_send(m_socket_id, &packet, &addr) < 0) {
+            m_send_errors.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        ++packet.frame.seq_number;
+    }
+
+    void sacn::send_frame(std::span<frame_universe const> const a_universes) {
+        m_frame_packets.clear();
+
+#if defined(__linux__)
+        auto const packet_count = a_universes.size();
+
+        m_frame_messages.resize(packet_count);
+        m_frame_buffers.resize(packet_count * 2);
+
+        // The header and start code come from the packet and the data straight from the universe, so universes
+        // mirrored to several universe numbers share one payload.
+        for (size_t i = 0; i < packet_count; ++i) {
+            auto const& [universe_number, universe] = a_universes[i];
+            auto& [addr, packet] = *m_frame_packets.emplace_back(&fetch_packet(universe_number));
+
+            m_frame_buffers[i * 2] = {
+                .iov_base = packet.raw,
+                .iov_len  = sizeof(packet.raw) - sizeof(packet.dmp.prop_val) + 1
+            };
+
+            m_frame_buffers[i * 2 + 1] = {
+                .iov_base = const_cast<uint8_t*>(universe->buffer() + 1),
+                .iov_len  = static_cast<size_t>(ntohs(packet.dmp.prop_val_cnt) - 1)
+            };
+
+            m_frame_messages[i] = {};
+            m_frame_messages[i].msg_hdr.msg_name    = &addr;
+            m_frame_messages[i].msg_hdr.msg_namelen = sizeof(addr);
+            m_frame_messages[i].msg_hdr.msg_iov     = &m_frame_buffers[i * 2];
+            m_frame_messages[i].msg_hdr.msg_iovlen  = 2;
+        }
+
+        // sendmmsg() may send fewer messages than requested; resume from the first unsent one. It fails only when the
+        // first message fails, which is then skipped so one bad destination does not drop the rest of the frame.
+        for (size_t sent = 0; sent < packet_count;) {
+            auto const result = sendmmsg(
+                m_socket_id,
+                m_frame_messages.data() + sent,
+                static_cast<unsigned int>(packet_count - sent),
+                0
+            );
+
+            if (result <= 0) {
+                m_send_errors.fetch_add(1, std::memory_order_relaxed);
+                sent += 1;
+                continue;
+            }
+
+            sent += result;
+        }
+#else
+        for (auto const& [universe_number, universe] : a_universes) {
+            auto* const universe_packet = m_frame_packets.emplace_back(&prepare_packet(universe_number, *universe));
+
+            if (e131_send(m_socket_id, &universe_packet->second, &universe_packet->first) < 0) {
+                m_send_errors.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+#endif
+
+        for (auto* const universe_packet : m_frame_packets) {
+            ++universe_packet->second.frame.seq_number;
+        }
+    }
+
+    sacn::universe_packet& sacn::fetch_packet(size_t const a_universe_number) {
         auto it = m_multicast_packets.find(a_universe_number);
 
         if (it == m_multicast_packets.cend()) {
             it = initialize_universe_packet(a_universe_number);
         }
 
-        auto& [addr, packet] = *it->second;
+        return *it->second;
+    }
+
+    sacn::universe_packet& sacn::prepare_packet(size_t const a_universe_number, address::universe const& a_universe) {
+        auto& universe_packet = fetch_packet(a_universe_number);
+        auto& [addr, packet] = universe_packet;
 
         auto tsize =  std::min(
-                sizeof(packet.dmp.prop_val),
+                dmx_data_channel_count,
                 a_universe.address_count()
         );
 
@@ -44,15 +128,13 @@ namespace monet::sink {
             tsize
         );
 
-        e131_send(m_socket_id, &packet, &addr);
-
-        ++packet.frame.seq_number;
+        return universe_packet;
     }
 
     decltype(sacn::m_multicast_packets)::iterator sacn::initialize_universe_packet(size_t const a_universe) {
         auto it = m_multicast_packets.emplace(
             a_universe,
-            std::make_unique<std::pair<e131_addr_t, e131_packet_t>>()
+            std::make_unique<universe_packet>()
         ).first;
 
         auto& [addr, packet] = *it->second;
@@ -61,7 +143,7 @@ namespace monet::sink {
         std::memcpy(
             &packet.frame.source_name,
             m_source_name.data(),
-            std::max(
+            std::min(
                 m_source_name.length() + 1,
                 sizeof(packet.frame.source_name)
             )
@@ -69,11 +151,11 @@ namespace monet::sink {
 
         e131_multicast_dest(
             &addr,
-            1,
+            a_universe,
             E131_DEFAULT_PORT
         );
 
         return it;
     }
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,121 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <monet.hpp>
+
+namespace monet::sink {
+
+    shared_memory::shared_memory(std::string a_name) noexcept :
+        sink("shared_memory"),
+        m_name(std::move(a_name)),
+        m_file(-1),
+        m_mapping(nullptr),
+        m_frame(0)
+    {
+        // The segment keeps the last state of every universe, so nothing needs resending.
+        set_unchanged_repeats(0);
+        set_keep_alive_interval(clock::duration::max());
+    }
+
+    shared_memory::~shared_memory() {
+        shared_memory::deinitialize();
+    }
+
+    bool shared_memory::initialize(server& a_server) {
+        deinitialize();
+
+        // A segment left behind by an earlier writer may still be mapped by readers, which would fault if it were
+        // truncated. Unlinking it leaves them their stale mapping, and they reopen the fresh segment by name.
+        shm_unlink(m_name.c_str());
+
+        if ((m_file = shm_open(m_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644)) < 0) {
+            return false;
+        }
+
+        // A new object is zero-filled.
+        if (ftruncate(m_file, static_cast<off_t>(shared_universes::segment_size)) < 0) {
+            deinitialize();
+            return false;
+        }
+
+        m_mapping = mmap(nullptr, shared_universes::segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_file, 0);
+
+        if (m_mapping == MAP_FAILED) {
+            m_mapping = nullptr;
+            deinitialize();
+            return false;
+        }
+
+        m_frame = 0;
+
+        auto& segment = header();
+        segment.version = shared_universes::segment_version;
+        segment.universe_size = sizeof(shared_universes::shared_universe);
+        segment.universe_count = max_universe_number + 1;
+        segment.writer = getpid();
+
+        // Readers load the magic first and only then the rest of the header, so set it last.
+        std::atomic_ref(segment.magic).store(shared_universes::segment_magic, std::memory_order_release);
+
+        // The first frame exports every universe.
+        reset_output_states();
+
+        return true;
+    }
+
+    void shared_memory::deinitialize() {
+        if (m_mapping) {
+            munmap(m_mapping, shared_universes::segment_size);
+            m_mapping = nullptr;
+        }
+
+        if (m_file >= 0) {
+            ::close(m_file);
+            m_file = -1;
+            shm_unlink(m_name.c_str());
+        }
+    }
+
+    void shared_memory::send_universe(size_t const a_universe_number, address::universe const& a_universe) {
+        frame_universe const universe{ a_universe_number, &a_universe };
+        send_frame(std::span(&universe, 1));
+    }
+
+    void shared_memory::send_frame(std::span<frame_universe const> const a_universes) {
+        if (!m_mapping) {
+            return;
+        }
+
+        auto const frame = m_frame + 1;
+
+        for (auto const& [universe_number, universe] : a_universes) {
+            if (!address::universe_table::valid(universe_number)) {
+                continue;
+            }
+
+            auto& shared = universe_at(universe_number);
+            auto const sequence = shared.sequence.load(std::memory_order_relaxed);
+
+            // Odd while writing, so readers retry rather than take a torn copy.
+            shared.sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            shared.frame = frame;
+            shared.address_count = static_cast<uint16_t>(std::min(universe->address_count(), universe_buffer_size));
+            std::memcpy(shared.data.data(), universe->buffer(), universe_buffer_size);
+
+            shared.sequence.store(sequence + 2, std::memory_order_release);
+        }
+
+        m_frame = frame;
+        header().frame.store(frame, std::memory_order_release);
+    }
+
+}
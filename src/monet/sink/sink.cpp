@@ -0,0 +1,38 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+
+namespace monet::sink {
+
+    bool sink::output_due(size_t const a_slot, address::universe const& a_universe, clock::time_point const a_now) {
+        if (a_slot >= m_output_states.size()) [[unlikely]] {
+            m_output_states.resize(a_slot + 1);
+        }
+
+        auto const& state = m_output_states[a_slot];
+
+        return state.generation != a_universe.generation()
+            || state.repeats < m_unchanged_repeats
+            || a_now - state.last_output >= m_keep_alive_interval;
+    }
+
+    void sink::mark_output(size_t const a_slot, address::universe const& a_universe, clock::time_point const a_now) noexcept {
+        if (a_slot >= m_output_states.size()) [[unlikely]] {
+            return;
+        }
+
+        auto& state = m_output_states[a_slot];
+
+        if (state.generation != a_universe.generation()) {
+            state.generation = a_universe.generation();
+            state.repeats = 0;
+        } else {
+            ++state.repeats;
+        }
+
+        state.last_output = a_now;
+    }
+
+}
@@ -0,0 +1,169 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+
+namespace monet {
+
+    sink_output::sink_output(sink::sink* const a_sink, size_t const a_framerate) noexcept :
+        m_sink(a_sink),
+        m_scheduler(a_framerate),
+        m_thread(),
+        m_running(false),
+        m_routes(),
+        m_slot(frame_exchange<frame_snapshot>::npos),
+        m_frame_index(),
+        m_frame_universes(),
+        m_output_frames(0),
+        m_skipped_frames(0),
+        m_latency(0),
+        m_max_latency(0)
+    {}
+
+    sink_output::~sink_output() {
+        if (m_thread.joinable()) {
+            m_running = false;
+            m_thread.join();
+        }
+    }
+
+    void sink_output::start(server& a_server, frame_exchange<frame_snapshot>& a_frames) {
+        m_sink->initialize(a_server);
+
+        m_max_latency.store(0, std::memory_order_relaxed);
+        m_running = true;
+
+        m_thread = std::thread([this, &a_frames] {
+            m_scheduler.reset(m_scheduler.frame_time() / 2);
+
+            while (m_running) {
+                m_scheduler.wait();
+                output_frame(a_frames);
+            }
+        });
+    }
+
+    void sink_output::stop(frame_exchange<frame_snapshot>& a_frames) {
+        if (!m_running.exchange(false)) {
+            return;
+        }
+
+        m_thread.join();
+        m_sink->deinitialize();
+
+        release(a_frames);
+    }
+
+    void sink_output::output_frame(frame_exchange<frame_snapshot>& a_frames) {
+        // Move on to the newest snapshot published, if there is one newer than the one held. The held snapshot is
+        // given back first so a sink output never holds more than one slot.
+        if (a_frames.latest() != m_slot) {
+            release(a_frames);
+            m_slot = a_frames.try_acquire_read();
+        }
+
+        if (m_slot == frame_exchange<frame_snapshot>::npos) {
+            return;
+        }
+
+        auto const& snapshot = a_frames.read(m_slot);
+
+        if (m_frame_index && snapshot.frame_index > *m_frame_index + 1) {
+            m_skipped_frames.fetch_add(snapshot.frame_index - *m_frame_index - 1, std::memory_order_relaxed);
+        }
+
+        m_frame_index = snapshot.frame_index;
+
+        auto const now = clock::now();
+
+        m_frame_universes.clear();
+
+        for (size_t slot = 0; slot < snapshot.universes.size(); ++slot) {
+            auto const& universe = snapshot.universes[slot];
+            auto const universe_number = snapshot.universe_numbers[slot];
+            auto const universe_routes = routes(universe_number);
+
+            if (!m_routes.empty() && universe_routes.empty()) {
+                continue;
+            }
+
+            // Skip universes that have not changed unless a keep-alive is due.
+            if (!m_sink->output_due(slot, universe, now)) {
+                continue;
+            }
+
+            m_sink->mark_output(slot, universe, now);
+
+            if (m_routes.empty()) {
+                m_frame_universes.push_back({ universe_number, &universe });
+                continue;
+            }
+
+            // Mirrors all point at the same snapshot universe.
+            for (auto const& universe_route : universe_routes) {
+                m_frame_universes.push_back({ universe_route.output_universe_number, &universe });
+            }
+        }
+
+        if (!m_frame_universes.empty()) {
+            m_sink->send_frame(m_frame_universes);
+        }
+
+        auto const latency = (clock::now() - snapshot.time).count();
+
+        m_latency.store(latency, std::memory_order_relaxed);
+        m_max_latency.store(std::max(latency, m_max_latency.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+        m_output_frames.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void sink_output::release(frame_exchange<frame_snapshot>& a_frames) noexcept {
+        if (m_slot != frame_exchange<frame_snapshot>::npos) {
+            a_frames.release(m_slot);
+            m_slot = frame_exchange<frame_snapshot>::npos;
+        }
+    }
+
+    void sink_output::set_routes(std::span<size_t const> const a_universes) {
+        m_routes.clear();
+
+        for (auto const universe_number : a_universes) {
+            add_route(universe_number, universe_number);
+        }
+    }
+
+    void sink_output::add_route(size_t const a_universe_number, size_t const a_output_universe_number) {
+        if (!address::universe_table::valid(a_universe_number) || !address::universe_table::valid(a_output_universe_number)) {
+            throw std::out_of_range("universe number out of range");
+        }
+
+        route const new_route{
+            static_cast<uint16_t>(a_universe_number),
+            static_cast<uint16_t>(a_output_universe_number)
+        };
+
+        auto const it = std::ranges::lower_bound(m_routes, new_route);
+
+        if (it == m_routes.end() || *it != new_route) {
+            m_routes.insert(it, new_route);
+        }
+    }
+
+    void sink_output::add_routes(size_t const a_first_universe_number, size_t const a_count, size_t const a_first_output_universe_number) {
+        for (size_t i = 0; i < a_count; ++i) {
+            add_route(a_first_universe_number + i, a_first_output_universe_number + i);
+        }
+    }
+
+    std::span<sink_output::route const> sink_output::routes(size_t const a_universe_number) const noexcept {
+        auto const [first, last] = std::ranges::equal_range(
+            m_routes,
+            a_universe_number,
+            std::less{},
+            &route::universe_number
+        );
+
+        return { first, last };
+    }
+
+}
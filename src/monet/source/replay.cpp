@@ -0,0 +1,125 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+
+namespace monet::source {
+
+    replay::replay(address::merge_engine& a_merge, uint8_t const a_priority) :
+        m_merge(a_merge),
+        m_source(a_merge.create_source("Replay", a_priority)),
+        m_player(),
+        m_playback_thread(),
+        m_running(false),
+        m_playing(false),
+        m_speed(1.0)
+    {}
+
+    replay::~replay() {
+        close();
+        m_merge.destroy_source(m_source);
+    }
+
+    bool replay::open(std::filesystem::path const& a_file) {
+        close();
+        return m_player.open(a_file);
+    }
+
+    void replay::close() {
+        stop();
+        m_player.close();
+        m_source.release_all();
+    }
+
+    bool replay::step() {
+        if (!m_player.next_frame()) {
+            return false;
+        }
+
+        output();
+        return true;
+    }
+
+    void replay::seek(std::chrono::nanoseconds const a_time) {
+        m_player.seek(a_time);
+        output();
+    }
+
+    bool replay::start(double const a_speed) {
+        // A show that played to its end leaves its thread finished but not joined.
+        if (m_running && !m_playing.load(std::memory_order_acquire)) {
+            stop();
+        }
+
+        if (m_running || !m_player.is_open() || a_speed < 0.0) {
+            return false;
+        }
+
+        m_speed = a_speed;
+        m_running = true;
+        m_playing = true;
+        m_playback_thread = std::thread([this] { playback_loop(); });
+
+        return true;
+    }
+
+    void replay::stop() {
+        if (!m_running.exchange(false)) {
+            return;
+        }
+
+        m_playback_thread.join();
+        m_playing = false;
+    }
+
+    void replay::output() {
+        auto& universes = m_player.universes();
+
+        for (auto const universe_number : m_player.changed()) {
+            auto* const universe = universes.find(universe_number);
+
+            if (!universe || !universe->dirty()) {
+                continue;
+            }
+
+            // The start code is not merged.
+            auto const [first, last] = universe->dirty_range();
+            auto const first_address = std::max<size_t>(first, 1);
+
+            if (first_address < last) {
+                m_source.set_addresses(universe_number, first_address, std::span(universe->buffer() + first_address, last - first_address));
+            }
+
+            universe->clear_dirty();
+        }
+    }
+
+    void replay::playback_loop() {
+        // Frame times are relative to when playback from the current point started.
+        auto const start_time = clock::now();
+        auto const start_offset = m_player.next_time();
+
+        while (m_running.load(std::memory_order_relaxed) && !m_player.finished()) {
+            if (m_speed > 0.0) {
+                auto const due = start_time + std::chrono::duration_cast<clock::duration>((m_player.next_time() - start_offset) / m_speed);
+
+                // Sleep in short steps so stopping is not held up by long pauses in the show.
+                while (m_running.load(std::memory_order_relaxed) && clock::now() < due) {
+                    std::this_thread::sleep_until(std::min(due, clock::now() + std::chrono::milliseconds(50)));
+                }
+
+                if (!m_running.load(std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+
+            if (!step()) {
+                break;
+            }
+        }
+
+        m_playing.store(false, std::memory_order_release);
+    }
+
+}
@@ -0,0 +1,247 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <algorithm>
+#include <cstring>
+
+#include <monet.hpp>
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <unistd.h>
+#endif
+
+namespace monet::source {
+
+    namespace {
+
+        /// Size of a packet up to the DMX start code.
+        constexpr size_t packet_header_size = sizeof(e131_packet_t::raw) - sizeof(e131_packet_t{}.dmp.prop_val);
+
+    }
+
+    sacn::sacn(address::merge_engine& a_merge, size_t const a_source_slots) :
+        m_merge(a_merge),
+        m_merge_sources(),
+        m_remote_sources(),
+        m_socket_id(-1),
+        m_receive_thread(),
+        m_running(false),
+        m_universes(max_universe_number + 1, false),
+        m_packets(sacn_receive_batch_size),
+        m_received_packets(0),
+        m_invalid_packets(0),
+        m_out_of_sequence_packets(0),
+        m_dropped_packets(0)
+    {
+        m_remote_sources.reserve(a_source_slots);
+
+        for (size_t i = 0; i < a_source_slots; ++i) {
+            m_merge_sources.push_back(&m_merge.create_source("sACN " + std::to_string(i + 1)));
+        }
+
+#if defined(__linux__)
+        m_messages.resize(m_packets.size());
+        m_buffers.resize(m_packets.size());
+
+        for (size_t i = 0; i < m_packets.size(); ++i) {
+            m_buffers[i] = { .iov_base = m_packets[i].raw, .iov_len = sizeof(m_packets[i].raw) };
+
+            m_messages[i] = {};
+            m_messages[i].msg_hdr.msg_iov    = &m_buffers[i];
+            m_messages[i].msg_hdr.msg_iovlen = 1;
+        }
+#endif
+    }
+
+    sacn::~sacn() {
+        stop();
+
+        for (auto const* const merge_source : m_merge_sources) {
+            m_merge.destroy_source(*merge_source);
+        }
+    }
+
+    bool sacn::start(std::span<size_t const> const a_universes, uint16_t const a_port) {
+        if (m_running) {
+            return false;
+        }
+
+        if ((m_socket_id = e131_socket()) < 0) {
+            return false;
+        }
+
+        if (e131_bind(m_socket_id, a_port) < 0) {
+            close(m_socket_id);
+            m_socket_id = -1;
+            return false;
+        }
+
+        // Wake up regularly so the thread notices when it is stopped and can time out silent remote sources.
+        timeval const timeout{
+            .tv_sec  = 0,
+            .tv_usec = std::chrono::duration_cast<std::chrono::microseconds>(sacn_receive_poll_interval).count()
+        };
+        setsockopt(m_socket_id, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+        std::fill(m_universes.begin(), m_universes.end(), false);
+
+        for (auto const universe_number : a_universes) {
+            if (address::universe_table::valid(universe_number)) {
+                m_universes[universe_number] = true;
+                e131_multicast_join(m_socket_id, static_cast<uint16_t>(universe_number));
+            }
+        }
+
+        m_running = true;
+        m_receive_thread = std::thread([this] { receive_loop(); });
+
+        return true;
+    }
+
+    void sacn::stop() {
+        if (!m_running.exchange(false)) {
+            return;
+        }
+
+        m_receive_thread.join();
+
+        close(m_socket_id);
+        m_socket_id = -1;
+
+        for (auto const& remote_source : m_remote_sources) {
+            remote_source.merge_source->release_all();
+        }
+
+        m_remote_sources.clear();
+    }
+
+    void sacn::receive_loop() {
+        while (m_running) {
+#if defined(__linux__)
+            // Block for the first packet only, then take whatever else is already queued.
+            auto const received = recvmmsg(
+                m_socket_id,
+                m_messages.data(),
+                static_cast<unsigned int>(m_messages.size()),
+                MSG_WAITFORONE,
+                nullptr
+            );
+
+            auto const now = clock::now();
+
+            for (int i = 0; i < received; ++i) {
+                process_packet(m_packets[i], m_messages[i].msg_len, now);
+            }
+#else
+            auto const received = e131_recv(m_socket_id, &m_packets.front());
+
+            auto const now = clock::now();
+
+            if (received > 0) {
+                process_packet(m_packets.front(), static_cast<size_t>(received), now);
+            }
+#endif
+
+            expire_remote_sources(now);
+        }
+    }
+
+    void sacn::process_packet(e131_packet_t const& a_packet, size_t const a_length, clock::time_point const a_now) {
+        m_received_packets.fetch_add(1, std::memory_order_relaxed);
+
+        auto const value_count = a_length >= packet_header_size ? ntohs(a_packet.dmp.prop_val_cnt) : 0;
+
+        if (value_count == 0 || packet_header_size + value_count > a_length || e131_pkt_validate(&a_packet) != E131_ERR_NONE) {
+            m_invalid_packets.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        auto const universe_number = static_cast<size_t>(ntohs(a_packet.frame.universe));
+
+        // Only the null start code carries levels; preview data is not meant for output.
+        if (!address::universe_table::valid(universe_number) || !m_universes[universe_number] ||
+            a_packet.dmp.prop_val[0] != 0 || (a_packet.frame.options & (1 << E131_OPT_PREVIEW))) {
+            return;
+        }
+
+        auto* const remote_source = fetch_remote_source(a_packet.root.cid);
+
+        if (!remote_source) {
+            m_dropped_packets.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        auto const [it, inserted] = remote_source->universes.try_emplace(universe_number, a_packet.frame.seq_number, a_now);
+
+        if (!inserted) {
+            if (e131_pkt_discard(&a_packet, it->second.first)) {
+                m_out_of_sequence_packets.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            it->second = { a_packet.frame.seq_number, a_now };
+        }
+
+        auto* const merge_source = remote_source->merge_source;
+
+        if (a_packet.frame.options & (1 << E131_OPT_TERMINATED)) {
+            merge_source->release(universe_number);
+            remote_source->universes.erase(it);
+            return;
+        }
+
+        // E1.31 priorities are per universe, so a remote source can send different universes at different priorities.
+        merge_source->set_priority(universe_number, a_packet.frame.priority);
+
+        merge_source->set_addresses(
+            universe_number,
+            1,
+            std::span(a_packet.dmp.prop_val + 1, std::min<size_t>(value_count - 1, dmx_data_channel_count))
+        );
+    }
+
+    void sacn::expire_remote_sources(clock::time_point const a_now) {
+        for (auto& remote_source : m_remote_sources) {
+            std::erase_if(remote_source.universes, [&] (auto const& a_universe) {
+                if (a_now - a_universe.second.second < sacn_source_timeout) {
+                    return false;
+                }
+
+                remote_source.merge_source->release(a_universe.first);
+                return true;
+            });
+        }
+
+        // Remote sources without universes left give their slot back.
+        std::erase_if(m_remote_sources, [] (remote_source const& a_remote_source) {
+            return a_remote_source.universes.empty();
+        });
+    }
+
+    sacn::remote_source* sacn::fetch_remote_source(uint8_t const* const a_cid) {
+        for (auto& remote_source : m_remote_sources) {
+            if (std::memcmp(remote_source.cid.data(), a_cid, remote_source.cid.size()) == 0) {
+                return &remote_source;
+            }
+        }
+
+        auto const slot = std::ranges::find_if(m_merge_sources, [&] (address::merge_source const* const a_merge_source) {
+            return std::ranges::none_of(m_remote_sources, [&] (remote_source const& a_remote_source) {
+                return a_remote_source.merge_source == a_merge_source;
+            });
+        });
+
+        if (slot == m_merge_sources.end()) {
+            return nullptr;
+        }
+
+        auto& remote_source = m_remote_sources.emplace_back();
+        std::memcpy(remote_source.cid.data(), a_cid, remote_source.cid.size());
+        remote_source.merge_source = *slot;
+
+        return &remote_source;
+    }
+
+}
@@ -0,0 +1,126 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+
+namespace monet {
+
+    worker_pool::worker_pool(size_t const a_thread_count) :
+        m_threads(),
+        m_task(nullptr),
+        m_task_context(nullptr),
+        m_task_count(0),
+        m_next_task(0),
+        m_active_workers(0),
+        m_run_generation(0),
+        m_stopping(false)
+    {
+        start_threads(a_thread_count);
+    }
+
+    worker_pool::~worker_pool() {
+        stop_threads();
+    }
+
+    void worker_pool::set_thread_count(size_t const a_thread_count) {
+        stop_threads();
+        start_threads(a_thread_count);
+    }
+
+    void worker_pool::start_threads(size_t const a_thread_count) {
+        m_stopping = false;
+
+        // The thread calling run() is one of the threads.
+        for (size_t i = 1; i < a_thread_count; ++i) {
+            m_threads.emplace_back(&worker_pool::worker_main, this, m_run_generation);
+        }
+    }
+
+    void worker_pool::stop_threads() {
+        {
+            std::lock_guard const lock(m_mutex);
+            m_stopping = true;
+        }
+
+        m_start_condition.notify_all();
+
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+
+        m_threads.clear();
+    }
+
+    void worker_pool::run_tasks(size_t const a_task_count, task_function const a_task, void* const a_context) {
+        if (a_task_count == 0) {
+            return;
+        }
+
+        // Not worth waking the workers for.
+        if (m_threads.empty() || a_task_count == 1) {
+            for (size_t i = 0; i < a_task_count; ++i) {
+                a_task(a_context, i);
+            }
+
+            return;
+        }
+
+        {
+            std::lock_guard const lock(m_mutex);
+
+            m_task = a_task;
+            m_task_context = a_context;
+            m_task_count = a_task_count;
+            m_next_task.store(0, std::memory_order_relaxed);
+            m_active_workers = m_threads.size();
+            ++m_run_generation;
+        }
+
+        m_start_condition.notify_all();
+
+        work();
+
+        std::unique_lock lock(m_mutex);
+        m_done_condition.wait(lock, [this] { return m_active_workers == 0; });
+    }
+
+    void worker_pool::work() noexcept {
+        for (;;) {
+            auto const index = m_next_task.fetch_add(1, std::memory_order_relaxed);
+
+            if (index >= m_task_count) {
+                return;
+            }
+
+            m_task(m_task_context, index);
+        }
+    }
+
+    void worker_pool::worker_main(uint64_t a_last_generation) {
+        auto last_generation = a_last_generation;
+
+        for (;;) {
+            {
+                std::unique_lock lock(m_mutex);
+                m_start_condition.wait(lock, [&] { return m_stopping || m_run_generation != last_generation; });
+
+                if (m_stopping) {
+                    return;
+                }
+
+                last_generation = m_run_generation;
+            }
+
+            work();
+
+            {
+                std::lock_guard const lock(m_mutex);
+                --m_active_workers;
+            }
+
+            m_done_condition.notify_one();
+        }
+    }
+
+}
@@ -75,4 +75,34 @@ TEST(Addresses, MasterAddressConversion) {
         size_t new_master_address = monet::address::to_master_address(universe, address);
         EXPECT_EQ(new_master_address, master_address);
     }
-}
\ No newline at end of file
+}
+TEST(Addresses, UniverseDirtyTracking) {
+    monet::address::universe universe;
+
+    EXPECT_FALSE(universe.dirty());
+    auto const initial_generation = universe.generation();
+
+    universe.set_address(20, 5);
+    universe.set_address(10, 6);
+
+    EXPECT_TRUE(universe.dirty());
+    EXPECT_EQ(universe.dirty_range(), (std::pair<size_t, size_t>{ 10, 21 }));
+    EXPECT_EQ(universe.generation(), initial_generation + 2);
+
+    universe.clear_dirty();
+    EXPECT_FALSE(universe.dirty());
+
+    // Writing an unchanged value does not mark the address.
+    universe.set_address(20, 5);
+    EXPECT_FALSE(universe.dirty());
+    EXPECT_EQ(universe.generation(), initial_generation + 2);
+
+    std::array<uint8_t, 3> values{ 1, 2, 3 };
+    universe.set_addresses(510, values);
+    EXPECT_EQ(universe.dirty_range(), (std::pair<size_t, size_t>{ 510, 513 }));
+
+    universe.clear_dirty();
+    auto range = universe.address_range(100, 4);
+    EXPECT_EQ(range.size(), 4);
+    EXPECT_EQ(universe.dirty_range(), (std::pair<size_t, size_t>{ 100, 104 }));
+}
@@ -59,4 +59,84 @@ TEST(Attributes, RGBColor) {
     EXPECT_EQ(color_attr->value(rgb_color::red),   110);
     EXPECT_EQ(color_attr->value(rgb_color::green), 225);
     EXPECT_EQ(color_attr->value(rgb_color::blue),  20 );
-}
\ No newline at end of file
+}
+
+TEST(Attributes, Store) {
+    using namespace monet::channel::attribute;
+
+    attribute_store store;
+
+    auto first  = registry::instantiate_attribute("rgb_color", store);
+    auto second = registry::instantiate_attribute("rgb_color", store);
+
+    first->set_value(rgb_color::green, 10);
+    second->set_value(rgb_color::blue, 20);
+
+    // Values of one type are packed together, slot after slot.
+    auto* pool = store.find_pool("rgb_color");
+
+    ASSERT_NE(pool, nullptr);
+    EXPECT_EQ(&first->pool(), pool);
+    EXPECT_EQ(pool->stride(), 6);
+    ASSERT_EQ(pool->chunk_count(), 1);
+    EXPECT_TRUE(std::ranges::equal(pool->chunk(0), std::array<uint8_t, 12>{ 0, 0, 10, 10, 0, 0, 0, 0, 0, 0, 20, 20 }));
+
+    EXPECT_EQ(first->value_offset(rgb_color::green), 2);
+    EXPECT_EQ(first->value_offset(rgb_color::green_fine), 3);
+    EXPECT_FALSE(first->value_offset(rgb_color::base).has_value());
+
+    // Released slots are zeroed and reused.
+    auto const slot = first->slot();
+    first.reset();
+
+    auto third = registry::instantiate_attribute("rgb_color", store);
+
+    EXPECT_EQ(third->slot(), slot);
+    EXPECT_EQ(third->value(rgb_color::green), 0);
+    EXPECT_EQ(pool->size(), 2);
+    EXPECT_EQ(store.find_pool("intensity"), nullptr);
+
+    // Values never move when the pool grows past a chunk.
+    auto const* const values = second->stored_values();
+    std::vector<std::unique_ptr<attribute>> more;
+
+    for (size_t i = 0; i < monet::attribute_pool_chunk_slots; ++i) {
+        more.push_back(registry::instantiate_attribute("rgb_color", store));
+    }
+
+    EXPECT_EQ(pool->chunk_count(), 2);
+    EXPECT_EQ(second->stored_values(), values);
+    EXPECT_EQ(second->value(rgb_color::blue), 20);
+}
+
+TEST(Attributes, FineChannels) {
+    using namespace monet::channel::attribute;
+
+    auto intensity_attr = registry::instantiate_attribute("intensity");
+    auto* intens = dynamic_cast<intensity*>(intensity_attr.get());
+
+    // 8-bit channels are derived from the 16-bit value.
+    intens->set_intensity_value_16(0x8040);
+
+    EXPECT_EQ(intensity_attr->value(intensity::base),      0x80);
+    EXPECT_EQ(intensity_attr->value(intensity::base_fine), 0x40);
+    EXPECT_EQ(intensity_attr->value(intensity::normal),    51);
+    EXPECT_EQ(intensity_attr->value_16(intensity::base),   0x8040);
+
+    // Full 8-bit values map to full 16-bit values.
+    intensity_attr->set_value(intensity::base, 255);
+    EXPECT_EQ(intens->intensity_value_16(), 0xFFFF);
+
+    intensity_attr->set_value(intensity::base_fine, 0x12);
+    EXPECT_EQ(intens->intensity_value_16(), 0xFF12);
+
+    auto color_attr = registry::instantiate_attribute("rgb_color");
+
+    color_attr->set_value_16(rgb_color::green, 0x1234);
+    color_attr->set_value(rgb_color::blue_fine, 0x56);
+
+    EXPECT_EQ(color_attr->value(rgb_color::green),      0x12);
+    EXPECT_EQ(color_attr->value(rgb_color::green_fine), 0x34);
+    EXPECT_EQ(color_attr->value_16(rgb_color::blue),    0x0056);
+    EXPECT_EQ(color_attr->value(rgb_color::red_fine),   0);
+}
@@ -251,4 +251,100 @@ TEST(Channels, AddressOutput) {
     EXPECT_EQ(data[5], 80);
     EXPECT_EQ(data[6], 180);
     EXPECT_EQ(data[7], 240);
-}
\ No newline at end of file
+}
+
+TEST(Channels, RenderPlan) {
+    monet::channel::configuration config("Render Plan Configuration");
+
+    config.add_attribute("intensity", monet::channel::attribute_definition("Intensity"));
+    config.add_attribute("rgb_color", monet::channel::attribute_definition("Color"));
+
+    config.address_mappings().emplace_back("intensity", 0);
+    config.address_mappings().emplace_back("rgb_color", 0, "blue");
+    config.address_mappings().emplace_back("missing", 0);
+    config.address_mappings().emplace_back("rgb_color", 4, "red");
+
+    monet::channel::channel channel(config);
+
+    auto const plan = channel.render_plan();
+
+    ASSERT_EQ(plan.size(), 4);
+    EXPECT_EQ(plan[0].attribute, channel.attributes("intensity")[0].get());
+    EXPECT_EQ(plan[0].channel, monet::channel::attribute::intensity::base);
+    EXPECT_EQ(plan[1].attribute, channel.attributes("rgb_color")[0].get());
+    EXPECT_EQ(plan[1].channel, monet::channel::attribute::rgb_color::blue);
+    EXPECT_EQ(plan[2].attribute, nullptr);
+    EXPECT_EQ(plan[3].attribute, nullptr);
+
+    channel.attributes("rgb_color")[0]->set_value(monet::channel::attribute::rgb_color::red, 42);
+
+    // Modifying the configuration after the channel is created recompiles the plan.
+    config.mapping(2).set_attribute_type("rgb_color");
+    config.mapping(2).set_attribute_channel("red");
+
+    auto const values = channel.fetch_address_values();
+
+    ASSERT_EQ(values.size(), 4);
+    EXPECT_EQ(values[2], 42);
+    EXPECT_EQ(values[3], 0);
+}
+
+TEST(Channels, DirectRender) {
+    monet::server server;
+
+    monet::channel::configuration config("Direct Render Configuration");
+
+    config.add_attribute("intensity", monet::channel::attribute_definition("Intensity"));
+    config.add_attribute("rgb_color", monet::channel::attribute_definition("Color"));
+
+    config.address_mappings().emplace_back("intensity", 0);
+    config.address_mappings().emplace_back("rgb_color", 0, "red");
+    config.address_mappings().emplace_back("rgb_color", 0, "green");
+
+    // Address 10 of universe 2.
+    auto& channel = server.create_channel(1, config, monet::address::to_master_address(2, 10));
+
+    channel.attributes("intensity")[0]->set_value(monet::channel::attribute::intensity::base, 200);
+    channel.set_rgb_color(12, 34, 56);
+
+    EXPECT_EQ(server.get_address_value(2, 10), 200);
+    EXPECT_EQ(server.get_address_value(2, 11), 12);
+    EXPECT_EQ(server.get_address_value(2, 12), 34);
+    EXPECT_EQ(server.get_universe(2).address_count(), 13);
+
+    // Channels running off the end of a universe are truncated.
+    auto& edge_channel = server.create_channel(2, config, monet::address::to_master_address(3, 511));
+    edge_channel.set_intensity(100);
+    edge_channel.set_rgb_color(1, 2, 3);
+
+    EXPECT_EQ(server.get_address_value(3, 511), 255);
+    EXPECT_EQ(server.get_address_value(3, 512), 1);
+
+    std::array<uint8_t, 2> partial{};
+    EXPECT_EQ(channel.render(partial), 2);
+    EXPECT_EQ(partial[0], 200);
+    EXPECT_EQ(partial[1], 12);
+}
+
+TEST(Channels, FineMappings) {
+    monet::channel::configuration config("Fine Mapping Configuration");
+
+    config.add_attribute("intensity", monet::channel::attribute_definition("Intensity"));
+    config.address_mappings().emplace_back("intensity", 0, "base");
+    config.address_mappings().emplace_back("intensity", 0, "base_fine");
+
+    monet::channel::channel channel(config);
+
+    auto* intensity = dynamic_cast<monet::channel::attribute::intensity*>(channel.attributes("intensity")[0].get());
+    intensity->set_intensity_value_16(0xABCD);
+
+    auto const values = channel.fetch_address_values();
+
+    ASSERT_EQ(values.size(), 2);
+    EXPECT_EQ(values[0], 0xAB);
+    EXPECT_EQ(values[1], 0xCD);
+
+    // Both bytes are read straight out of the attribute pool.
+    EXPECT_NE(channel.render_plan()[0].value, nullptr);
+    EXPECT_NE(channel.render_plan()[1].value, nullptr);
+}
@@ -0,0 +1,70 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <thread>
+
+#include <monet.hpp>
+#include <gtest/gtest.h>
+
+TEST(CommandQueue, Bounded) {
+    monet::command_queue<int, 4> queue;
+
+    int value = 0;
+    EXPECT_FALSE(queue.dequeue(value));
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.enqueue(i));
+    }
+
+    EXPECT_FALSE(queue.enqueue(4));
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.dequeue(value));
+        EXPECT_EQ(value, i);
+    }
+
+    EXPECT_FALSE(queue.dequeue(value));
+    EXPECT_TRUE(queue.enqueue(5));
+}
+
+TEST(CommandQueue, MultipleProducers) {
+    constexpr size_t producer_count = 4;
+    constexpr size_t per_producer = 20000;
+
+    monet::command_queue<size_t, 256> queue;
+
+    std::vector<std::thread> producers;
+
+    for (size_t producer = 0; producer < producer_count; ++producer) {
+        producers.emplace_back([&, producer] {
+            for (size_t i = 0; i < per_producer;) {
+                if (queue.enqueue(producer * per_producer + i)) {
+                    ++i;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Values from each producer arrive in order and none are lost.
+    std::array<size_t, producer_count> next{};
+    size_t received = 0;
+    size_t value = 0;
+
+    while (received < producer_count * per_producer) {
+        if (queue.dequeue(value)) {
+            auto const producer = value / per_producer;
+            ASSERT_EQ(value % per_producer, next[producer]);
+            ++next[producer];
+            ++received;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+}
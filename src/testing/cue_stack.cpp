@@ -0,0 +1,100 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+    class CueStack : public testing::Test {
+    protected:
+        monet::channel::configuration m_config{"Cue Configuration"};
+        std::vector<std::unique_ptr<monet::channel::channel>> m_channels;
+        monet::fade_engine m_fades;
+        std::vector<monet::channel::channel*> m_updated;
+
+        void SetUp() override {
+            m_config.add_attribute("intensity", monet::channel::attribute_definition("Intensity"));
+
+            for (size_t i = 0; i < 3; ++i) {
+                m_channels.push_back(std::make_unique<monet::channel::channel>(m_config));
+            }
+        }
+
+        monet::cue_value value(size_t const a_index, uint16_t const a_value) {
+            auto& channel = *m_channels[a_index];
+            return { &channel, channel.attributes("intensity")[0].get(), monet::channel::attribute::attribute::base, a_value };
+        }
+
+        uint16_t intensity(size_t const a_index) {
+            return m_channels[a_index]->attributes("intensity")[0]->value_16(monet::channel::attribute::attribute::base);
+        }
+    };
+
+}
+
+TEST_F(CueStack, Deltas) {
+    monet::cue_stack stack("Main");
+
+    stack.add_cue({ .name = "1", .values = { value(0, 1000), value(1, 2000) } });
+    stack.add_cue({ .name = "2", .values = { value(0, 1000), value(1, 3000), value(2, 4000) } });
+    stack.add_cue({ .name = "3", .values = { value(2, 4000) } });
+
+    stack.compile();
+
+    // Only values differing from the tracked state after the previous cue are in a delta.
+    EXPECT_EQ(stack.delta(0).size(), 2);
+    ASSERT_EQ(stack.delta(1).size(), 2);
+    EXPECT_EQ(stack.delta(1)[0].value, 3000);
+    EXPECT_EQ(stack.delta(1)[1].value, 4000);
+    EXPECT_TRUE(stack.delta(2).empty());
+
+    // Editing the cues recompiles the deltas.
+    stack.cues()[2].values.push_back(value(0, 0));
+    EXPECT_EQ(stack.delta(2).size(), 1);
+}
+
+TEST_F(CueStack, Go) {
+    monet::cue_stack stack;
+
+    stack.add_cue({ .name = "1", .values = { value(0, 65535), value(1, 65535) } });
+    stack.add_cue({ .name = "2", .values = { value(1, 0) }, .fade_time = 1s });
+
+    EXPECT_EQ(stack.current(), monet::cue_stack::npos);
+
+    // Cues without a fade time are set immediately and their channels queued for rendering.
+    EXPECT_TRUE(stack.go(m_fades, m_updated));
+    EXPECT_EQ(stack.current(), 0);
+    EXPECT_EQ(intensity(0), 65535);
+    EXPECT_EQ(intensity(1), 65535);
+    EXPECT_EQ(m_updated.size(), 2);
+    EXPECT_EQ(m_fades.size(), 0);
+
+    // Only the changed channel fades.
+    m_updated.clear();
+    auto const now = monet::cue_stack::clock::now();
+
+    EXPECT_TRUE(stack.go(m_fades, m_updated, now));
+    EXPECT_EQ(m_fades.size(), 1);
+    EXPECT_TRUE(m_updated.empty());
+
+    m_fades.advance(now + 500ms, m_updated);
+    EXPECT_NEAR(intensity(1), 32768, 1);
+    EXPECT_EQ(intensity(0), 65535);
+
+    EXPECT_FALSE(stack.go(m_fades, m_updated));
+
+    // Jumping back restores the full tracked state of the cue.
+    m_channels[0]->attributes("intensity")[0]->set_value(monet::channel::attribute::attribute::base, 0);
+
+    EXPECT_TRUE(stack.go_to(0, m_fades, m_updated));
+    EXPECT_EQ(intensity(0), 65535);
+    EXPECT_EQ(intensity(1), 65535);
+    EXPECT_EQ(m_fades.size(), 0);
+
+    stack.remove_channel(*m_channels[1]);
+    EXPECT_EQ(stack.cues()[1].values.size(), 0);
+}
@@ -0,0 +1,138 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+    class Effects : public testing::Test {
+    protected:
+        monet::channel::configuration m_config{"Effect Configuration"};
+        std::vector<std::unique_ptr<monet::channel::channel>> m_channels;
+        monet::worker_pool m_pool;
+
+        void SetUp() override {
+            m_config.add_attribute("intensity", monet::channel::attribute_definition("Intensity"));
+
+            for (size_t i = 0; i < 4; ++i) {
+                m_channels.push_back(std::make_unique<monet::channel::channel>(m_config));
+            }
+        }
+
+        void add_members(monet::effect& a_effect) {
+            for (auto& channel : m_channels) {
+                a_effect.add_member(*channel, *channel->attributes("intensity")[0], monet::channel::attribute::attribute::base);
+            }
+        }
+
+        uint16_t intensity(size_t const a_index) {
+            return m_channels[a_index]->attributes("intensity")[0]->value_16(monet::channel::attribute::attribute::base);
+        }
+    };
+
+}
+
+TEST_F(Effects, Waveforms) {
+    monet::effect effect(monet::effect_waveform::sine, 1.0f, 0, 40000, 0.25f);
+    add_members(effect);
+
+    auto const start = monet::effect::clock::now();
+    effect.restart(start);
+    effect.evaluate(start, m_pool);
+
+    // A sine chased a quarter period apart: middle, top, middle, bottom.
+    EXPECT_NEAR(intensity(0), 20000, 40);
+    EXPECT_NEAR(intensity(1), 40000, 40);
+    EXPECT_NEAR(intensity(2), 20000, 40);
+    EXPECT_NEAR(intensity(3), 0, 40);
+
+    effect.set_waveform(monet::effect_waveform::triangle);
+    effect.evaluate(start + 250ms, m_pool);
+
+    EXPECT_EQ(intensity(0), 20000);
+    EXPECT_EQ(intensity(1), 40000);
+    EXPECT_EQ(intensity(2), 20000);
+    EXPECT_EQ(intensity(3), 0);
+
+    effect.set_waveform(monet::effect_waveform::square);
+    effect.set_duty(0.5f);
+    effect.evaluate(start, m_pool);
+
+    EXPECT_EQ(intensity(0), 40000);
+    EXPECT_EQ(intensity(1), 40000);
+    EXPECT_EQ(intensity(2), 0);
+    EXPECT_EQ(intensity(3), 0);
+
+    // Noise stays in range and differs between members.
+    effect.set_waveform(monet::effect_waveform::noise);
+    effect.set_range(1000, 2000);
+    effect.evaluate(start, m_pool);
+
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_GE(intensity(i), 1000);
+        EXPECT_LE(intensity(i), 2000);
+    }
+
+    EXPECT_NE(intensity(0), intensity(1));
+}
+
+TEST_F(Effects, RemoveChannel) {
+    monet::effect_engine engine;
+
+    auto& effect = engine.create(monet::effect_waveform::square, 1.0f, 0, 65535, 0.25f);
+    add_members(effect);
+
+    EXPECT_EQ(effect.channels().size(), 4);
+
+    engine.remove_channel(*m_channels[1]);
+
+    ASSERT_EQ(effect.members().size(), 3);
+    EXPECT_EQ(effect.members()[1].channel, m_channels[2].get());
+    EXPECT_EQ(effect.channels().size(), 3);
+
+    std::vector<monet::channel::channel*> updated;
+    engine.advance(monet::effect::clock::now(), m_pool, updated);
+
+    EXPECT_EQ(updated.size(), 3);
+
+    engine.destroy(effect);
+    EXPECT_TRUE(engine.effects().empty());
+}
+
+TEST(EffectEngine, Parallel) {
+    monet::channel::configuration config("Effect Configuration");
+    config.add_attribute("rgb_color", monet::channel::attribute_definition("Color"));
+
+    std::vector<std::unique_ptr<monet::channel::channel>> channels;
+
+    monet::effect serial(monet::effect_waveform::sine, 0.5f, 0, 65535, 0.001f);
+    monet::effect parallel(monet::effect_waveform::sine, 0.5f, 0, 65535, 0.001f);
+
+    // Enough members for several blocks.
+    for (size_t i = 0; i < monet::effect_block_size * 3 + 17; ++i) {
+        auto& channel = *channels.emplace_back(std::make_unique<monet::channel::channel>(config));
+        serial.add_member(channel, *channel.attributes("rgb_color")[0], monet::channel::attribute::rgb_color::red);
+        parallel.add_member(channel, *channel.attributes("rgb_color")[0], monet::channel::attribute::rgb_color::green);
+    }
+
+    monet::worker_pool single_pool;
+    monet::worker_pool parallel_pool(4);
+
+    auto const now = monet::effect::clock::now();
+    serial.restart(now);
+    parallel.restart(now);
+
+    serial.evaluate(now + 300ms, single_pool);
+    parallel.evaluate(now + 300ms, parallel_pool);
+
+    EXPECT_TRUE(std::ranges::equal(serial.values(), parallel.values()));
+
+    for (auto const& channel : channels) {
+        auto const& color = *channel->attributes("rgb_color")[0];
+        EXPECT_EQ(color.value_16(monet::channel::attribute::rgb_color::red), color.value_16(monet::channel::attribute::rgb_color::green));
+    }
+}
@@ -0,0 +1,102 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+TEST(FadeEngine, Evaluate) {
+    auto const start = monet::fade_engine::clock::time_point{};
+
+    monet::fade fade{
+        .start_time = start,
+        .duration = 1000ms,
+        .start_value = 0,
+        .target_value = 40000,
+        .curve = monet::fade_curve::linear
+    };
+
+    EXPECT_EQ(monet::fade_engine::evaluate(fade, start), 0);
+    EXPECT_EQ(monet::fade_engine::evaluate(fade, start + 250ms), 10000);
+    EXPECT_EQ(monet::fade_engine::evaluate(fade, start + 1000ms), 40000);
+    EXPECT_EQ(monet::fade_engine::evaluate(fade, start + 5000ms), 40000);
+
+    fade.curve = monet::fade_curve::ease_in;
+    EXPECT_EQ(monet::fade_engine::evaluate(fade, start + 500ms), 10000);
+
+    fade.curve = monet::fade_curve::ease_out;
+    EXPECT_EQ(monet::fade_engine::evaluate(fade, start + 500ms), 30000);
+
+    fade.curve = monet::fade_curve::ease_in_out;
+    EXPECT_EQ(monet::fade_engine::evaluate(fade, start + 500ms), 20000);
+
+    // Fading down.
+    fade.curve = monet::fade_curve::linear;
+    fade.start_value = 60000;
+    fade.target_value = 20000;
+    EXPECT_EQ(monet::fade_engine::evaluate(fade, start + 750ms), 30000);
+
+    // Slow fades move in steps much finer than one 8-bit step.
+    fade.duration = 60s;
+    fade.start_value = 0;
+    fade.target_value = 257;
+    EXPECT_EQ(monet::fade_engine::evaluate(fade, start + 30s), 129);
+}
+
+TEST(FadeEngine, Advance) {
+    monet::channel::configuration config("Fade Configuration");
+    config.add_attribute("intensity", monet::channel::attribute_definition("Intensity"));
+    config.add_attribute("rgb_color", monet::channel::attribute_definition("Color"));
+
+    monet::channel::channel first(config);
+    monet::channel::channel second(config);
+
+    auto& intensity = *first.attributes("intensity")[0];
+    auto& color     = *second.attributes("rgb_color")[0];
+
+    using monet::channel::attribute::rgb_color;
+
+    monet::fade_engine engine;
+    std::vector<monet::channel::channel*> updated;
+
+    auto const start = monet::fade_engine::clock::now();
+
+    EXPECT_TRUE(engine.start(first, intensity, monet::channel::attribute::attribute::base, 100 * 257, 100ms, monet::fade_curve::linear, start));
+    EXPECT_TRUE(engine.start(second, color, rgb_color::red, 200 * 257, 200ms, monet::fade_curve::linear, start));
+    EXPECT_EQ(engine.size(), 2);
+
+    engine.advance(start + 50ms, updated);
+
+    EXPECT_EQ(intensity.value(), 50);
+    EXPECT_EQ(color.value(rgb_color::red), 50);
+    EXPECT_EQ(updated.size(), 2);
+
+    // The first fade finishes and is retired; the second is still advanced in the same frame.
+    updated.clear();
+    engine.advance(start + 100ms, updated);
+
+    EXPECT_EQ(intensity.value(), 100);
+    EXPECT_EQ(color.value(rgb_color::red), 100);
+    EXPECT_EQ(engine.size(), 1);
+    EXPECT_EQ(updated.size(), 2);
+
+    // Fading the same attribute channel again replaces the fade, starting from its current value.
+    EXPECT_TRUE(engine.start(second, color, rgb_color::red, 0, 100ms, monet::fade_curve::linear, start + 100ms));
+    EXPECT_EQ(engine.size(), 1);
+    EXPECT_EQ(engine.fades()[0].start_value, 100 * 257);
+
+    // Setting a value immediately stops the fade.
+    EXPECT_FALSE(engine.start(second, color, rgb_color::red, 7 * 257, 0ms));
+    EXPECT_EQ(engine.size(), 0);
+    EXPECT_EQ(color.value(rgb_color::red), 7);
+
+    engine.start(second, color, rgb_color::green, 65535, 1s);
+    engine.start(second, color, rgb_color::blue, 65535, 1s);
+    engine.start(first, intensity, monet::channel::attribute::attribute::base, 0, 1s);
+
+    engine.cancel(second);
+    EXPECT_EQ(engine.size(), 1);
+    EXPECT_EQ(engine.fades()[0].channel, &first);
+}
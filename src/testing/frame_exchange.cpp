@@ -0,0 +1,117 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <thread>
+
+#include <monet.hpp>
+#include <gtest/gtest.h>
+
+TEST(FrameExchange, SingleThreaded) {
+    monet::frame_exchange<int> exchange(3);
+
+    EXPECT_EQ(exchange.try_acquire_read(), monet::frame_exchange<int>::npos);
+
+    auto* slot = exchange.try_acquire_write();
+    ASSERT_NE(slot, nullptr);
+    *slot = 1;
+    exchange.publish();
+
+    // Both consumers read the newest value.
+    auto const first = exchange.try_acquire_read();
+    auto const second = exchange.try_acquire_read();
+    ASSERT_EQ(first, second);
+    EXPECT_EQ(exchange.read(first), 1);
+
+    // The producer never writes the slot being read, and moves on while the consumers hold it.
+    for (int i = 2; i < 6; ++i) {
+        slot = exchange.try_acquire_write();
+        ASSERT_NE(slot, nullptr);
+        *slot = i;
+        exchange.publish();
+    }
+
+    EXPECT_EQ(exchange.read(first), 1);
+
+    exchange.release(first);
+    exchange.release(second);
+
+    auto const newest = exchange.try_acquire_read();
+    EXPECT_EQ(exchange.read(newest), 5);
+    exchange.release(newest);
+}
+
+TEST(FrameExchange, Exhausted) {
+    monet::frame_exchange<int> exchange(2);
+
+    *exchange.try_acquire_write() = 1;
+    exchange.publish();
+
+    // One consumer holds the newest slot, so only the other slot is free.
+    auto const held = exchange.try_acquire_read();
+
+    *exchange.try_acquire_write() = 2;
+    exchange.publish();
+
+    // A second consumer holding the newest leaves no slot to write.
+    auto const newest = exchange.try_acquire_read();
+    EXPECT_EQ(exchange.try_acquire_write(), nullptr);
+
+    exchange.release(held);
+    EXPECT_NE(exchange.try_acquire_write(), nullptr);
+    exchange.release(newest);
+}
+
+TEST(FrameExchange, ProducerConsumers) {
+    constexpr size_t count = 100000;
+    constexpr size_t consumer_count = 2;
+
+    // Slots hold a value and its double, so torn reads are caught.
+    monet::frame_exchange<std::pair<size_t, size_t>> exchange(consumer_count + 2);
+    std::atomic_bool done = false;
+
+    std::thread producer([&] {
+        for (size_t i = 1; i <= count;) {
+            if (auto* const slot = exchange.try_acquire_write()) {
+                *slot = { i, i * 2 };
+                exchange.publish();
+                ++i;
+            }
+        }
+
+        done = true;
+    });
+
+    std::vector<std::thread> consumers;
+    std::array<bool, consumer_count> failed{};
+
+    for (size_t consumer = 0; consumer < consumer_count; ++consumer) {
+        consumers.emplace_back([&, consumer] {
+            size_t last = 0;
+
+            while (!done) {
+                auto const index = exchange.try_acquire_read();
+
+                if (index == monet::frame_exchange<std::pair<size_t, size_t>>::npos) {
+                    continue;
+                }
+
+                auto const [value, doubled] = exchange.read(index);
+
+                // Values never go backwards or tear.
+                failed[consumer] |= value < last || doubled != value * 2;
+                last = value;
+
+                exchange.release(index);
+            }
+        });
+    }
+
+    producer.join();
+
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+
+    EXPECT_EQ(failed, (std::array<bool, consumer_count>{}));
+}
@@ -0,0 +1,54 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <thread>
+
+#include <monet.hpp>
+#include <gtest/gtest.h>
+
+TEST(FrameScheduler, Pacing) {
+    using namespace std::chrono_literals;
+
+    monet::frame_scheduler scheduler(100);
+    EXPECT_EQ(scheduler.framerate(), 100);
+    EXPECT_EQ(scheduler.frame_time(), 10ms);
+
+    scheduler.reset();
+    auto const start = monet::frame_scheduler::clock::now();
+
+    for (int i = 0; i < 10; ++i) {
+        scheduler.wait();
+    }
+
+    auto const elapsed = monet::frame_scheduler::clock::now() - start;
+
+    // Ten deadlines on a fixed grid, the first one frame after the reset.
+    EXPECT_GE(elapsed, 100ms);
+    EXPECT_EQ(scheduler.frame_count(), 10);
+}
+
+TEST(FrameScheduler, MissedFrames) {
+    using namespace std::chrono_literals;
+
+    monet::frame_scheduler scheduler(100);
+    scheduler.reset();
+
+    scheduler.wait();
+    EXPECT_EQ(scheduler.missed_frames(), 0);
+
+    // Stall for several frames past the next deadline.
+    std::this_thread::sleep_for(45ms);
+
+    scheduler.wait();
+    EXPECT_GE(scheduler.missed_frames(), 3);
+
+    // The schedule catches up to the grid instead of bursting the missed frames: the next wait is for a single frame.
+    // A loaded machine may still overrun that one frame, so only a single further miss is allowed for.
+    auto const missed = scheduler.missed_frames();
+    auto const frames = scheduler.frame_count();
+    scheduler.wait();
+
+    EXPECT_EQ(scheduler.frame_count(), frames + 1);
+    EXPECT_LE(scheduler.missed_frames(), missed + 1);
+}
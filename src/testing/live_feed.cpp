@@ -0,0 +1,258 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+    using type = monet::command::command_type;
+
+    class LiveFeed : public testing::Test {
+    protected:
+        monet::server m_server;
+        monet::interface::live_feed& m_feed = m_server.web_panel_interface().feed();
+
+        void SetUp() override {
+            auto& config = m_server.channel_configuration("rgb");
+            config.add_attribute("intensity", monet::channel::attribute_definition("Intensity"));
+            config.add_attribute("rgb_color", monet::channel::attribute_definition("Color"));
+            config.address_mappings().emplace_back("intensity", 0);
+            config.address_mappings().emplace_back("rgb_color", 0, "red");
+
+            m_server.create_channel(1, "rgb", 1);
+            m_server.create_channel(2, "rgb", 10);
+        }
+
+        /// Queue setting an attribute value of a channel, applied with the next frame.
+        void set(size_t const a_channel, std::string_view const a_type, std::string_view const a_attribute_channel, uint8_t const a_value) {
+            m_server.enqueue_command({
+                .type = type::set_attribute_value,
+                .target = a_channel,
+                .attribute_type = std::string(a_type),
+                .attribute_channel = std::string(a_attribute_channel),
+                .value = a_value
+            });
+        }
+
+        /// Parse the data of an event.
+        static nlohmann::json data(monet::interface::live_feed::event const& a_event) {
+            auto const begin = a_event.message.find("data: ");
+            return nlohmann::json::parse(a_event.message.substr(begin + 6));
+        }
+
+        /// Get the event following a sequence number, without waiting.
+        std::shared_ptr<monet::interface::live_feed::event const> event_after(uint64_t const a_sequence) {
+            return m_feed.next_event(a_sequence, 0ms);
+        }
+    };
+
+}
+
+TEST_F(LiveFeed, Deltas) {
+    m_feed.subscribe();
+
+    set(1, "intensity", "base", 200);
+    m_server.render_frame();
+
+    // Every value is sent at first.
+    ASSERT_TRUE(m_feed.publish());
+    EXPECT_EQ(m_feed.sequence(), 1);
+
+    auto const first = event_after(0);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first->sequence, 1);
+    EXPECT_TRUE(first->message.starts_with("id: 1\nevent: delta\n"));
+    EXPECT_TRUE(first->message.ends_with("\n\n"));
+
+    auto const first_data = data(*first);
+    EXPECT_EQ(first_data["sequence"], 1);
+    EXPECT_EQ(first_data["channels"]["1"]["intensity"][0]["base"], 200);
+    EXPECT_EQ(first_data["channels"]["1"]["rgb_color"][0]["red"], 0);
+    EXPECT_FALSE(first_data["channels"].contains("2"));
+
+    // Afterwards, only the attribute channels that changed.
+    set(1, "rgb_color", "red", 50);
+    m_server.render_frame();
+    ASSERT_TRUE(m_feed.publish());
+
+    auto const second_data = data(*event_after(1));
+    EXPECT_EQ(second_data["sequence"], 2);
+    EXPECT_EQ(second_data["channels"]["1"]["rgb_color"][0]["red"], 50);
+    EXPECT_FALSE(second_data["channels"]["1"].contains("intensity"));
+    EXPECT_FALSE(second_data["channels"]["1"]["rgb_color"][0].contains("green"));
+
+    // Rendering a channel without changing it publishes nothing.
+    set(1, "rgb_color", "red", 50);
+    m_server.render_frame();
+    EXPECT_FALSE(m_feed.publish());
+    EXPECT_EQ(m_feed.sequence(), 2);
+
+    m_feed.unsubscribe();
+}
+
+TEST_F(LiveFeed, Coalescing) {
+    m_feed.subscribe();
+
+    set(1, "intensity", "base", 10);
+    set(2, "intensity", "base", 20);
+    m_server.render_frame();
+    ASSERT_TRUE(m_feed.publish());
+
+    // Frames rendered before the next publish are sent as one event holding the latest values.
+    set(1, "intensity", "base", 11);
+    m_server.render_frame();
+    set(1, "intensity", "base", 12);
+    set(2, "intensity", "base", 22);
+    m_server.render_frame();
+
+    ASSERT_TRUE(m_feed.publish());
+    EXPECT_EQ(m_feed.sequence(), 2);
+
+    auto const delta = data(*event_after(1));
+    EXPECT_EQ(delta["channels"]["1"]["intensity"][0]["base"], 12);
+    EXPECT_EQ(delta["channels"]["2"]["intensity"][0]["base"], 22);
+
+    m_feed.unsubscribe();
+}
+
+TEST_F(LiveFeed, NoSubscribers) {
+    set(1, "intensity", "base", 200);
+    m_server.render_frame();
+
+    // Nothing is captured.
+    EXPECT_FALSE(m_feed.publish());
+
+    // A value changed back while nobody was subscribed is still sent to the next subscriber.
+    m_feed.subscribe();
+    set(1, "intensity", "base", 0);
+    m_server.render_frame();
+    ASSERT_TRUE(m_feed.publish());
+
+    EXPECT_EQ(data(*event_after(0))["channels"]["1"]["intensity"][0]["base"], 0);
+
+    m_feed.unsubscribe();
+}
+
+TEST_F(LiveFeed, Backlog) {
+    m_feed.subscribe();
+
+    // New subscribers resync first, then follow from the sequence they are given.
+    auto const resync = m_feed.next_event(std::nullopt, 0ms);
+    ASSERT_NE(resync, nullptr);
+    EXPECT_EQ(resync->sequence, 0);
+    EXPECT_TRUE(resync->message.starts_with("id: 0\nevent: resync\n"));
+
+    for (size_t i = 1; i <= monet::live_feed_backlog + 2; ++i) {
+        set(1, "intensity", "base", static_cast<uint8_t>(i));
+        m_server.render_frame();
+        ASSERT_TRUE(m_feed.publish());
+    }
+
+    auto const latest = m_feed.sequence();
+    EXPECT_EQ(latest, monet::live_feed_backlog + 2);
+
+    // Every subscriber is handed the same event.
+    EXPECT_EQ(event_after(latest - 1), event_after(latest - 1));
+    EXPECT_EQ(event_after(latest - 1)->sequence, latest);
+
+    // Subscribers that fell behind the backlog, or reconnect with a sequence from before a restart, resync.
+    EXPECT_TRUE(event_after(1)->message.find("event: resync") != std::string::npos);
+    EXPECT_EQ(event_after(1)->sequence, latest);
+    EXPECT_TRUE(event_after(latest + 5)->message.find("event: resync") != std::string::npos);
+
+    // Subscribers that are up to date wait.
+    EXPECT_EQ(m_feed.next_event(latest, 10ms), nullptr);
+
+    m_feed.unsubscribe();
+}
+
+TEST_F(LiveFeed, DeletedChannels) {
+    m_feed.subscribe();
+
+    set(1, "intensity", "base", 10);
+    set(2, "intensity", "base", 20);
+    m_server.render_frame();
+    ASSERT_TRUE(m_feed.publish());
+
+    // Deleted channels are sent once as null, and their values forgotten.
+    m_server.delete_channel(2);
+    ASSERT_TRUE(m_feed.publish());
+
+    auto const deleted = data(*event_after(1));
+    EXPECT_TRUE(deleted["channels"]["2"].is_null());
+    EXPECT_FALSE(deleted["channels"].contains("1"));
+
+    // A channel created again under the number is sent in full.
+    m_server.create_channel(2, "rgb", 10);
+    set(2, "intensity", "base", 0);
+    m_server.render_frame();
+    ASSERT_TRUE(m_feed.publish());
+
+    auto const created = data(*event_after(2));
+    EXPECT_EQ(created["channels"]["2"]["intensity"][0]["base"], 0);
+    EXPECT_EQ(created["channels"]["2"]["rgb_color"][0]["red"], 0);
+
+    // Channels never sent are not reported.
+    m_server.delete_channel(1);
+    m_server.delete_channel(2);
+    m_server.create_channel(3, "rgb", 20);
+    m_server.delete_channel(3);
+    ASSERT_TRUE(m_feed.publish());
+    EXPECT_FALSE(data(*event_after(3))["channels"].contains("3"));
+
+    m_feed.unsubscribe();
+}
+
+TEST_F(LiveFeed, SubscriberLimit) {
+    EXPECT_TRUE(m_feed.subscribe(2));
+    EXPECT_TRUE(m_feed.subscribe(2));
+    EXPECT_FALSE(m_feed.subscribe(2));
+    EXPECT_EQ(m_feed.subscribers(), 2);
+
+    m_feed.unsubscribe();
+    EXPECT_TRUE(m_feed.subscribe(2));
+
+    m_feed.unsubscribe();
+    m_feed.unsubscribe();
+
+    // Some web panel threads always stay free for API requests.
+    auto& web_panel = m_server.web_panel_interface();
+    EXPECT_EQ(web_panel.max_live_subscribers(), monet::default_web_panel_threads - monet::web_panel_reserved_threads);
+
+    web_panel.set_thread_count(4);
+    EXPECT_EQ(web_panel.max_live_subscribers(), 2);
+}
+
+TEST_F(LiveFeed, Push) {
+    m_feed.start();
+    m_feed.subscribe();
+    EXPECT_EQ(m_feed.subscribers(), 1);
+
+    m_server.start();
+    set(2, "rgb_color", "red", 80);
+
+    // The publishing thread publishes the frame as soon as it is rendered.
+    auto const event = m_feed.next_event(0, 1s);
+    ASSERT_NE(event, nullptr);
+    EXPECT_EQ(data(*event)["channels"]["2"]["rgb_color"][0]["red"], 80);
+
+    m_server.stop();
+
+    // Stopping wakes subscribers waiting for an event.
+    std::thread waiter([&] {
+        EXPECT_EQ(m_feed.next_event(event->sequence, 10s), nullptr);
+    });
+
+    std::this_thread::sleep_for(10ms);
+    m_feed.stop();
+    waiter.join();
+
+    EXPECT_TRUE(m_feed.stopping());
+
+    m_feed.unsubscribe();
+    EXPECT_EQ(m_feed.subscribers(), 0);
+}
@@ -0,0 +1,169 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+#include <gtest/gtest.h>
+
+using monet::address::merge_mode;
+
+TEST(MergeEngine, PassThrough) {
+    monet::address::merge_engine engine;
+    monet::address::universe rendered;
+
+    rendered.set_address(1, 10);
+
+    // Universes no source has written are output as rendered.
+    EXPECT_EQ(engine.merge(1, rendered), nullptr);
+
+    auto& source = engine.create_source("Override");
+    source.set_address(2, 1, 50);
+
+    EXPECT_EQ(engine.merge(1, rendered), nullptr);
+    EXPECT_NE(engine.merge(2, rendered), nullptr);
+}
+
+TEST(MergeEngine, HighestTakesPrecedence) {
+    monet::address::merge_engine engine;
+    monet::address::universe rendered;
+
+    rendered.set_address(1, 100);
+    rendered.set_address(2, 100);
+
+    auto& first  = engine.create_source("First");
+    auto& second = engine.create_source("Second");
+
+    std::array<uint8_t, 3> const values{ 50, 150, 200 };
+    first.set_addresses(1, 1, values);
+    second.set_address(1, 3, 220);
+
+    auto const* merged = engine.merge(1, rendered);
+    ASSERT_NE(merged, nullptr);
+    EXPECT_EQ(merged->address(1), 100);
+    EXPECT_EQ(merged->address(2), 150);
+    EXPECT_EQ(merged->address(3), 220);
+    EXPECT_EQ(merged->address_count(), 4);
+
+    // Nothing changed, so the merged universe is left alone.
+    auto const generation = merged->generation();
+    EXPECT_EQ(engine.merge(1, rendered)->generation(), generation);
+
+    // Released addresses fall back to what remains.
+    second.release(1, 3, 1);
+    EXPECT_EQ(engine.merge(1, rendered)->address(3), 200);
+
+    first.release(1);
+    merged = engine.merge(1, rendered);
+    EXPECT_EQ(merged->address(2), 100);
+    EXPECT_EQ(merged->address(3), 0);
+    EXPECT_FALSE(first.address(1, 2).has_value());
+    EXPECT_EQ(second.address(1, 3), std::nullopt);
+}
+
+TEST(MergeEngine, Priorities) {
+    monet::address::merge_engine engine;
+    monet::address::universe rendered;
+
+    rendered.set_address(1, 200);
+    rendered.set_address(2, 200);
+
+    // A source above the render priority overrides the rendered value, even with a lower value.
+    auto& manual = engine.create_source("Manual", 150);
+    manual.set_address(1, 1, 20);
+
+    auto const* merged = engine.merge(1, rendered);
+    EXPECT_EQ(merged->address(1), 20);
+    EXPECT_EQ(merged->address(2), 200);
+
+    // A source below the render priority never shows.
+    auto& background = engine.create_source("Background", 50);
+    background.set_address(1, 2, 255);
+    EXPECT_EQ(engine.merge(1, rendered)->address(2), 200);
+
+    manual.set_priority(10);
+    EXPECT_EQ(engine.merge(1, rendered)->address(1), 200);
+
+    engine.set_render_priority(5);
+    merged = engine.merge(1, rendered);
+    EXPECT_EQ(merged->address(1), 20);
+    EXPECT_EQ(merged->address(2), 255);
+
+    engine.destroy_source(manual);
+    EXPECT_EQ(engine.sources().size(), 1);
+    EXPECT_EQ(engine.merge(1, rendered)->address(1), 200);
+}
+
+TEST(MergeEngine, UniversePriorities) {
+    monet::address::merge_engine engine;
+    monet::address::universe rendered;
+
+    rendered.set_address(1, 200);
+
+    auto& source = engine.create_source("Remote", 150);
+    source.set_address(1, 1, 20);
+    source.set_address(2, 1, 20);
+
+    // A priority set on one universe leaves the others at the priority of the source.
+    source.set_priority(1, 50);
+    EXPECT_EQ(source.priority(1), 50);
+    EXPECT_EQ(source.priority(2), 150);
+    EXPECT_EQ(engine.merge(1, rendered)->address(1), 200);
+    EXPECT_EQ(engine.merge(2, rendered)->address(1), 20);
+
+    // Releasing the universe drops its priority.
+    source.release(1);
+    EXPECT_EQ(source.priority(1), 150);
+}
+
+TEST(MergeEngine, LatestTakesPrecedence) {
+    monet::address::merge_engine engine;
+    monet::address::universe rendered;
+
+    engine.set_mode(1, 1, 2, merge_mode::ltp);
+    EXPECT_EQ(engine.mode(1, 2), merge_mode::ltp);
+    EXPECT_EQ(engine.mode(1, 3), merge_mode::htp);
+
+    rendered.set_address(1, 200);
+    rendered.set_address(3, 200);
+    EXPECT_EQ(engine.merge(1, rendered)->address(1), 200);
+
+    // The latest write wins on LTP addresses, even with a lower value.
+    auto& source = engine.create_source("Override");
+    source.set_address(1, 1, 10);
+    source.set_address(1, 3, 10);
+
+    auto const* merged = engine.merge(1, rendered);
+    EXPECT_EQ(merged->address(1), 10);
+    EXPECT_EQ(merged->address(3), 200);
+
+    // A change to the rendered value is newer than the source.
+    rendered.clear_dirty();
+    rendered.set_address(1, 100);
+    EXPECT_EQ(engine.merge(1, rendered)->address(1), 100);
+
+    source.set_address(1, 1, 30);
+    EXPECT_EQ(engine.merge(1, rendered)->address(1), 30);
+}
+
+TEST(MergeEngine, ConcurrentWriters) {
+    monet::address::merge_engine engine;
+    monet::address::universe rendered;
+
+    auto& source = engine.create_source("Network");
+
+    std::thread writer([&] {
+        for (uint8_t value = 1; value < 255; ++value) {
+            source.set_address(1, 1, value);
+        }
+    });
+
+    // Merging while the source is written from another thread only ever sees whole writes.
+    for (size_t i = 0; i < 1000; ++i) {
+        if (auto const* merged = engine.merge(1, rendered)) {
+            EXPECT_LE(merged->address(1), 254);
+        }
+    }
+
+    writer.join();
+    EXPECT_EQ(engine.merge(1, rendered)->address(1), 254);
+}
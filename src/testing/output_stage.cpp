@@ -0,0 +1,114 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+#include <gtest/gtest.h>
+
+using monet::address::dimmer_curve;
+using monet::address::output_stage;
+using monet::address::output_transform;
+
+TEST(OutputStage, Tables) {
+    std::array<uint8_t, 256> table{};
+
+    output_stage::build_table({}, 255, table);
+    EXPECT_EQ(table[0], 0);
+    EXPECT_EQ(table[128], 128);
+    EXPECT_EQ(table[255], 255);
+
+    output_stage::build_table({ .curve = dimmer_curve::square }, 255, table);
+    EXPECT_EQ(table[128], 64);
+    EXPECT_EQ(table[255], 255);
+
+    output_stage::build_table({ .gamma = 2.2f }, 255, table);
+    EXPECT_LT(table[128], 64);
+    EXPECT_EQ(table[255], 255);
+
+    // Mastering scales after limits and before inversion.
+    output_stage::build_table({ .mastered = true, .max = 200, .invert = true }, 128, table);
+    EXPECT_EQ(table[0], 255);
+    EXPECT_EQ(table[255], 155);
+
+    // A grand master of 0 blacks out mastered fixtures, minimum or not.
+    output_stage::build_table({ .mastered = true, .min = 20 }, 0, table);
+    EXPECT_EQ(table[0], 0);
+    EXPECT_EQ(table[255], 0);
+
+    output_stage::build_table({ .min = 20, .max = 200 }, 255, table);
+    EXPECT_EQ(table[0], 20);
+    EXPECT_EQ(table[255], 200);
+
+    // The grand master leaves unmastered transforms alone.
+    output_stage::build_table({}, 0, table);
+    EXPECT_EQ(table[255], 255);
+}
+
+TEST(OutputStage, Properties) {
+    monet::channel::attribute_definition definition("Intensity", {
+        { "curve", "square" },
+        { "gamma", "2.5" },
+        { "max", "180" },
+        { "invert", "true" },
+        { "min", "not a number" }
+    });
+
+    auto const transform = output_transform::from_properties(definition, true);
+    EXPECT_EQ(transform.curve, dimmer_curve::square);
+    EXPECT_FLOAT_EQ(transform.gamma, 2.5f);
+    EXPECT_TRUE(transform.mastered);
+    EXPECT_EQ(transform.min, 0);
+    EXPECT_EQ(transform.max, 180);
+    EXPECT_TRUE(transform.invert);
+
+    definition.set_property("master", "false");
+    EXPECT_FALSE(output_transform::from_properties(definition, true).mastered);
+    EXPECT_TRUE(output_transform::from_properties(monet::channel::attribute_definition("Pan")).identity());
+}
+
+TEST(OutputStage, Apply) {
+    output_stage stage;
+    monet::address::universe source;
+
+    source.set_address(1, 255);
+    source.set_address(2, 255);
+    source.set_address(100, 128);
+
+    // Universes without transforms pass straight through.
+    EXPECT_EQ(stage.apply(1, source), nullptr);
+    stage.set_transform(1, 3, {});
+    EXPECT_EQ(stage.apply(1, source), nullptr);
+
+    stage.set_transform(1, 1, { .invert = true });
+    stage.set_transform(1, 100, { .curve = dimmer_curve::square, .mastered = true });
+    EXPECT_TRUE(stage.transform(1, 1).invert);
+    EXPECT_TRUE(stage.transform(1, 2).identity());
+
+    auto const* output = stage.apply(1, source);
+    ASSERT_NE(output, nullptr);
+    EXPECT_EQ(output->address(1), 0);
+    EXPECT_EQ(output->address(2), 255);
+    EXPECT_EQ(output->address(100), 64);
+    EXPECT_EQ(output->address_count(), source.address_count());
+
+    // Unchanged input leaves the output alone.
+    auto const generation = output->generation();
+    EXPECT_EQ(stage.apply(1, source)->generation(), generation);
+
+    stage.set_grand_master(0);
+    output = stage.apply(1, source);
+    EXPECT_EQ(output->address(1), 0);
+    EXPECT_EQ(output->address(100), 0);
+
+    stage.set_grand_master(255);
+    source.set_address(2, 10);
+    EXPECT_EQ(stage.apply(1, source)->address(2), 10);
+    EXPECT_EQ(stage.apply(1, source)->address(100), 64);
+
+    // Cleared universes keep being output from their own copy, untransformed.
+    stage.clear();
+    output = stage.apply(1, source);
+    ASSERT_NE(output, nullptr);
+    EXPECT_EQ(output->address(1), 255);
+    EXPECT_EQ(output->address(100), 128);
+}
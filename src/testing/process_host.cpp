@@ -0,0 +1,214 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <csignal>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+#include <monet.hpp>
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+    /// Values of the first address that make the hosted sink crash or hang.
+    constexpr uint8_t crash_value = 99;
+    constexpr uint8_t hang_value = 98;
+
+    /// Exports to shared memory, so the test process can see what the child output, unless told to crash or hang.
+    class faulty_sink : public monet::sink::shared_memory {
+    public:
+        using shared_memory::shared_memory;
+
+        void send_frame(std::span<monet::sink::frame_universe const> const a_universes) override {
+            for (auto const& [universe_number, universe] : a_universes) {
+                if (universe->address(1) == crash_value) {
+                    kill(getpid(), SIGKILL);
+                }
+
+                if (universe->address(1) == hang_value) {
+                    for (;;) {
+                        std::this_thread::sleep_for(1h);
+                    }
+                }
+            }
+
+            shared_memory::send_frame(a_universes);
+        }
+    };
+
+    class ProcessHost : public testing::Test {
+    protected:
+        std::string m_name = "/monet-host-test-" + std::to_string(getpid());
+        monet::server m_server;
+        monet::address::universe& m_universe = m_server.create_universe(1);
+        std::array<monet::sink::frame_universe, 1> const m_frame{{ { 1, &m_universe } }};
+
+        /// Create a host running a faulty_sink.
+        std::unique_ptr<monet::sink::process_host> create_host(std::chrono::milliseconds const a_stall_timeout = 1000ms, size_t const a_universe_capacity = monet::default_process_host_universes) const {
+            return std::make_unique<monet::sink::process_host>(
+                [name = m_name] { return std::make_unique<faulty_sink>(name); },
+                a_universe_capacity,
+                a_stall_timeout
+            );
+        }
+
+        /// Send a frame with the first address set to a value.
+        static void send(monet::sink::process_host& a_host, monet::address::universe& a_universe, std::span<monet::sink::frame_universe const> const a_frame, uint8_t const a_value) {
+            a_universe.set_address(1, a_value);
+            a_host.send_frame(a_frame);
+        }
+
+        /// Wait until the child has finished with every frame, then read the first address it exported.
+        std::optional<uint8_t> exported_value(monet::sink::process_host const& a_host) const {
+            for (auto const deadline = std::chrono::steady_clock::now() + 2s; a_host.pending_frames() > 0 && std::chrono::steady_clock::now() < deadline;) {
+                std::this_thread::sleep_for(1ms);
+            }
+
+            monet::shared_universes::reader reader;
+            monet::shared_universes::universe_snapshot snapshot{};
+
+            if (!reader.open(m_name.c_str()) || !reader.read(1, snapshot)) {
+                return std::nullopt;
+            }
+
+            return snapshot.data[1];
+        }
+
+        /// Supervise the host until it has restarted the child a number of times.
+        static bool wait_for_restarts(monet::sink::process_host& a_host, size_t const a_restarts) {
+            for (auto const deadline = std::chrono::steady_clock::now() + 5s; std::chrono::steady_clock::now() < deadline;) {
+                a_host.supervise();
+
+                if (a_host.restarts() >= a_restarts) {
+                    return true;
+                }
+
+                std::this_thread::sleep_for(1ms);
+            }
+
+            return false;
+        }
+    };
+
+}
+
+TEST_F(ProcessHost, Output) {
+    auto const host = create_host();
+    ASSERT_TRUE(host->initialize(m_server));
+    EXPECT_GT(host->child(), 0);
+    EXPECT_NE(host->child(), getpid());
+
+    // The ring holds the frames sent faster than the child outputs them.
+    for (size_t value = 1; value <= monet::process_host_ring_slots; ++value) {
+        send(*host, m_universe, m_frame, static_cast<uint8_t>(value));
+    }
+
+    EXPECT_EQ(exported_value(*host), monet::process_host_ring_slots);
+    EXPECT_EQ(host->restarts(), 0);
+    EXPECT_EQ(host->dropped_frames(), 0);
+
+    host->deinitialize();
+    EXPECT_EQ(host->child(), 0);
+}
+
+TEST_F(ProcessHost, RestartAfterCrash) {
+    auto const host = create_host();
+    ASSERT_TRUE(host->initialize(m_server));
+
+    send(*host, m_universe, m_frame, 10);
+    EXPECT_EQ(exported_value(*host), 10);
+
+    auto const crashed_child = host->child();
+    send(*host, m_universe, m_frame, crash_value);
+
+    ASSERT_TRUE(wait_for_restarts(*host, 1));
+    EXPECT_NE(host->child(), crashed_child);
+
+    // Only the frame the child died on is lost.
+    send(*host, m_universe, m_frame, 11);
+    EXPECT_EQ(exported_value(*host), 11);
+    EXPECT_EQ(host->restarts(), 1);
+    EXPECT_EQ(host->dropped_frames(), 1);
+}
+
+TEST_F(ProcessHost, RestartAfterStall) {
+    auto const host = create_host(200ms);
+    ASSERT_TRUE(host->initialize(m_server));
+
+    send(*host, m_universe, m_frame, 10);
+    EXPECT_EQ(exported_value(*host), 10);
+
+    // Frames keep being accepted while the child hangs, until it is killed.
+    send(*host, m_universe, m_frame, hang_value);
+    send(*host, m_universe, m_frame, 12);
+
+    ASSERT_TRUE(wait_for_restarts(*host, 1));
+
+    // The frame queued behind the one it hung on is still output.
+    EXPECT_EQ(exported_value(*host), 12);
+    EXPECT_EQ(host->restarts(), 1);
+    EXPECT_EQ(host->dropped_frames(), 1);
+}
+
+TEST_F(ProcessHost, FailedStart) {
+    // The child reports a factory that throws, rather than unwinding into the copy of the server.
+    monet::sink::process_host throwing([] () -> std::unique_ptr<monet::sink::sink> {
+        throw std::runtime_error("No device");
+    });
+
+    EXPECT_FALSE(throwing.initialize(m_server));
+    EXPECT_EQ(throwing.child(), 0);
+
+    monet::sink::process_host empty([] { return nullptr; });
+    EXPECT_FALSE(empty.initialize(m_server));
+}
+
+TEST_F(ProcessHost, RetryFailedStart) {
+    // The hosted sink cannot start until its device, stood in for by a file, is ready.
+    auto const device = std::filesystem::temp_directory_path() / ("monet-host-device-" + std::to_string(getpid()));
+
+    monet::sink::process_host host([name = m_name, device] () -> std::unique_ptr<monet::sink::sink> {
+        if (!std::filesystem::exists(device)) {
+            return nullptr;
+        }
+
+        return std::make_unique<faulty_sink>(name);
+    });
+
+    EXPECT_FALSE(host.initialize(m_server));
+    EXPECT_EQ(host.child(), 0);
+
+    std::ofstream(device).put('\n');
+
+    // The host keeps retrying, so the sink starts once the device is ready.
+    ASSERT_TRUE(wait_for_restarts(host, 1));
+    send(host, m_universe, m_frame, 10);
+    EXPECT_EQ(exported_value(host), 10);
+
+    std::filesystem::remove(device);
+}
+
+TEST_F(ProcessHost, Capacity) {
+    // The ring holds at least as many universes as the server has.
+    auto const host = create_host(1000ms, 0);
+    ASSERT_TRUE(host->initialize(m_server));
+
+    send(*host, m_universe, m_frame, 10);
+    EXPECT_EQ(exported_value(*host), 10);
+    EXPECT_EQ(host->dropped_frames(), 0);
+
+    // Universes beyond it are cut off, and counted.
+    auto& other = m_server.create_universe(2);
+    std::array<monet::sink::frame_universe, 2> const frame{{ { 1, &m_universe }, { 2, &other } }};
+
+    send(*host, m_universe, frame, 11);
+    EXPECT_EQ(exported_value(*host), 11);
+    EXPECT_EQ(host->dropped_frames(), 1);
+}
@@ -0,0 +1,126 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <filesystem>
+#include <thread>
+
+#include <monet.hpp>
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+    class Recorder : public testing::Test {
+    protected:
+        std::filesystem::path m_path = std::filesystem::temp_directory_path() / "monet_recorder_test.rec";
+
+        void TearDown() override {
+            std::filesystem::remove(m_path);
+        }
+    };
+
+}
+
+TEST_F(Recorder, Frames) {
+    monet::server server;
+
+    auto* recorder = new monet::sink::recorder(m_path, 30ms);
+    auto& output = server.add_sink(recorder);
+
+    server.create_universe(1).set_address(1, 10);
+    server.create_universe(2).set_address(512, 20);
+
+    ASSERT_TRUE(recorder->initialize(server));
+
+    // The first frame is a keyframe with every universe.
+    server.poll();
+    EXPECT_EQ(recorder->record_count(), 3);
+
+    // Later frames only record what changed.
+    server.set_address_value(2, 512, 21);
+    server.poll();
+    EXPECT_EQ(recorder->record_count(), 4);
+
+    server.poll();
+    EXPECT_EQ(recorder->record_count(), 4);
+
+    // Once the index interval has passed, the frame after it is a keyframe again.
+    std::this_thread::sleep_for(40ms);
+    server.set_address_value(1, 1, 11);
+    server.poll();
+    EXPECT_EQ(recorder->record_count(), 5);
+
+    server.poll();
+    EXPECT_EQ(recorder->record_count(), 8);
+    EXPECT_EQ(output.output_frames(), 5);
+
+    // Readers see every complete frame while recording continues.
+    monet::recording::reader reader;
+    ASSERT_TRUE(reader.open(m_path));
+    EXPECT_EQ(reader.records().size(), 8);
+    EXPECT_EQ(reader.header().frame_count, 4);
+
+    recorder->deinitialize();
+    EXPECT_EQ(std::filesystem::file_size(m_path), sizeof(monet::recording::file_header) + 8 * sizeof(monet::recording::record));
+
+    ASSERT_TRUE(reader.open(m_path));
+
+    auto const records = reader.records();
+    ASSERT_EQ(records.size(), 8);
+
+    EXPECT_TRUE(records[0].index());
+    EXPECT_EQ(records[0].address_count, 2);
+    EXPECT_EQ(records[1].universe_number, 1);
+    EXPECT_EQ(records[1].data[1], 10);
+    EXPECT_EQ(records[2].universe_number, 2);
+    EXPECT_EQ(records[2].address_count, monet::universe_buffer_size);
+    EXPECT_EQ(records[2].data[512], 20);
+
+    EXPECT_EQ(records[3].frame, 1);
+    EXPECT_EQ(records[3].universe_number, 2);
+    EXPECT_EQ(records[3].data[512], 21);
+
+    EXPECT_EQ(records[4].frame, 2);
+    EXPECT_EQ(records[4].universe_number, 1);
+    EXPECT_EQ(records[4].data[1], 11);
+
+    EXPECT_TRUE(records[5].index());
+    EXPECT_EQ(records[5].frame, 3);
+    EXPECT_EQ(records[6].data[1], 11);
+    EXPECT_EQ(records[7].data[512], 21);
+
+    // Seeking lands on the index entry that starts the keyframe at or before the time.
+    EXPECT_EQ(reader.seek(std::chrono::nanoseconds(records[0].time)), 0);
+    EXPECT_EQ(reader.seek(std::chrono::nanoseconds(records[3].time)), 0);
+    EXPECT_EQ(reader.seek(std::chrono::nanoseconds(records[4].time)), 0);
+    EXPECT_EQ(reader.seek(std::chrono::nanoseconds(records[5].time)), 5);
+    EXPECT_EQ(reader.seek(1h), 5);
+}
+
+TEST_F(Recorder, Growth) {
+    monet::server server;
+    monet::sink::recorder recorder(m_path, 1h);
+
+    auto& universe = server.create_universe(1);
+    ASSERT_TRUE(recorder.initialize(server));
+
+    std::array<monet::sink::frame_universe, 1> const frame{{ { 1, &universe } }};
+
+    // Write past the initial mapping so the file is grown and remapped.
+    for (size_t i = 0; i < monet::recording_growth_records + 10; ++i) {
+        universe.set_address(1, static_cast<uint8_t>(i));
+        recorder.send_frame(frame);
+    }
+
+    EXPECT_FALSE(recorder.full());
+    recorder.deinitialize();
+
+    monet::recording::reader reader;
+    ASSERT_TRUE(reader.open(m_path));
+
+    auto const records = reader.records();
+    ASSERT_EQ(records.size(), monet::recording_growth_records + 11);
+    EXPECT_EQ(records.back().data[1], static_cast<uint8_t>(monet::recording_growth_records + 9));
+}
@@ -0,0 +1,237 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <filesystem>
+#include <map>
+#include <thread>
+
+#include <monet.hpp>
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+    /// Universes recorded every frame.
+    constexpr size_t show_universes = 8;
+    constexpr size_t show_frames = 1000;
+
+    /// Records a mostly static show and compacts it into a show file.
+    class Replay : public testing::Test {
+    protected:
+        std::filesystem::path m_recording_path = std::filesystem::temp_directory_path() / "monet_replay_test.rec";
+        std::filesystem::path m_show_path = std::filesystem::temp_directory_path() / "monet_replay_test.show";
+        monet::recording::reader m_recording;
+
+        void SetUp() override {
+            monet::server server;
+            monet::sink::recorder recorder(m_recording_path, 1h);
+            std::vector<monet::address::universe*> universes;
+            std::vector<monet::sink::frame_universe> frame;
+
+            for (size_t universe_number = 1; universe_number <= show_universes; ++universe_number) {
+                auto& universe = server.create_universe(universe_number);
+
+                // A static look, with a block of fixtures at one level.
+                universe.set_address(monet::dmx_data_channel_count, 0);
+
+                for (size_t address = 1; address <= 48; ++address) {
+                    universe.set_address(address, static_cast<uint8_t>(universe_number * 10));
+                }
+
+                universes.push_back(&universe);
+                frame.push_back({ universe_number, &universe });
+            }
+
+            ASSERT_TRUE(recorder.initialize(server));
+
+            // Every universe is recorded every frame, while one channel fades and another snaps every so often.
+            for (size_t i = 0; i < show_frames; ++i) {
+                universes[0]->set_address(100, static_cast<uint8_t>(i / 4));
+
+                if (i % 100 == 0) {
+                    universes[3]->set_address(200, static_cast<uint8_t>(i / 100 * 20));
+                }
+
+                recorder.send_frame(frame);
+                std::this_thread::sleep_for(10us);
+            }
+
+            recorder.deinitialize();
+            ASSERT_TRUE(m_recording.open(m_recording_path));
+        }
+
+        void TearDown() override {
+            m_recording.close();
+            std::filesystem::remove(m_recording_path);
+            std::filesystem::remove(m_show_path);
+        }
+
+        /// The state of every universe after the recorded frames up to a time.
+        std::map<size_t, std::array<uint8_t, monet::universe_buffer_size>> recorded_state(uint64_t const a_time) const {
+            std::map<size_t, std::array<uint8_t, monet::universe_buffer_size>> state;
+
+            for (auto const& record : m_recording.records()) {
+                if (record.time > a_time) {
+                    break;
+                }
+
+                if (!record.index()) {
+                    state[record.universe_number] = record.data;
+                }
+            }
+
+            return state;
+        }
+
+        /// Check that the decoded universes match the recording at the time of the frame decoded last.
+        void expect_state(monet::recording::show_player const& a_player) const {
+            for (auto const& [universe_number, data] : recorded_state(static_cast<uint64_t>(a_player.time().count()))) {
+                auto const* const universe = a_player.universes().find(universe_number);
+                ASSERT_NE(universe, nullptr);
+                EXPECT_TRUE(std::equal(data.begin(), data.end(), universe->buffer())) << "universe " << universe_number;
+            }
+        }
+    };
+
+}
+
+TEST_F(Replay, Compression) {
+    ASSERT_TRUE(monet::recording::encode_show_file(m_recording, m_show_path));
+
+    auto const recording_size = std::filesystem::file_size(m_recording_path);
+    auto const show_size = std::filesystem::file_size(m_show_path);
+
+    EXPECT_GE(recording_size / show_size, 50) << recording_size << " bytes compacted to " << show_size;
+}
+
+TEST_F(Replay, Decode) {
+    ASSERT_TRUE(monet::recording::encode_show_file(m_recording, m_show_path));
+
+    monet::recording::show_player player;
+    ASSERT_TRUE(player.open(m_show_path));
+    EXPECT_EQ(player.header().keyframe_count, 1);
+
+    // The first frame is a keyframe with every universe.
+    ASSERT_TRUE(player.next_frame());
+    EXPECT_EQ(player.changed().size(), show_universes);
+    expect_state(player);
+
+    // Later frames only hold what changed, and only that is marked dirty.
+    for (auto const universe_number : player.changed()) {
+        player.universes().find(universe_number)->clear_dirty();
+    }
+
+    ASSERT_TRUE(player.next_frame());
+    ASSERT_EQ(player.changed().size(), 1);
+    EXPECT_EQ(player.changed()[0], 1);
+    EXPECT_EQ(player.universes().find(1)->dirty_range(), std::make_pair(size_t{100}, size_t{101}));
+    expect_state(player);
+
+    while (player.next_frame()) {
+        expect_state(player);
+    }
+
+    EXPECT_TRUE(player.finished());
+    EXPECT_EQ(player.frame(), player.header().frame_count);
+    EXPECT_EQ(player.universes().find(1)->address(100), (show_frames - 1) / 4);
+    EXPECT_EQ(player.universes().find(4)->address(200), 180);
+}
+
+TEST_F(Replay, Seek) {
+    auto const records = m_recording.records();
+    auto const duration = records.back().time;
+
+    // Several keyframes to seek between.
+    ASSERT_TRUE(monet::recording::encode_show_file(m_recording, m_show_path, std::chrono::nanoseconds(duration / 8)));
+
+    monet::recording::show_player player;
+    ASSERT_TRUE(player.open(m_show_path));
+    EXPECT_GE(player.keyframes().size(), 4);
+
+    for (auto const fraction : { 0.1, 0.3, 0.5, 0.9, 1.0 }) {
+        auto const time = static_cast<uint64_t>(static_cast<double>(duration) * fraction);
+
+        player.seek(std::chrono::nanoseconds(time));
+        EXPECT_LE(static_cast<uint64_t>(player.time().count()), time);
+        EXPECT_EQ(player.changed().size(), show_universes);
+        expect_state(player);
+    }
+
+    // Seeking back rebuilds the state from an earlier keyframe.
+    player.seek(0ns);
+    EXPECT_EQ(player.frame(), 1);
+    EXPECT_EQ(player.universes().find(1)->address(100), 0);
+    EXPECT_EQ(player.universes().find(4)->address(200), 0);
+}
+
+TEST_F(Replay, Source) {
+    ASSERT_TRUE(monet::recording::encode_show_file(m_recording, m_show_path));
+
+    monet::address::merge_engine merge;
+    monet::address::universe rendered;
+    auto replay_source = std::make_unique<monet::source::replay>(merge);
+    auto& replay = *replay_source;
+
+    ASSERT_TRUE(replay.open(m_show_path));
+    ASSERT_TRUE(replay.step());
+
+    auto const* merged = merge.merge(2, rendered);
+    ASSERT_NE(merged, nullptr);
+    EXPECT_EQ(merged->address(1), 20);
+
+    // Play the rest as fast as possible.
+    ASSERT_TRUE(replay.start(0.0));
+
+    for (auto const deadline = std::chrono::steady_clock::now() + 5s; replay.playing() && std::chrono::steady_clock::now() < deadline;) {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    replay.stop();
+    EXPECT_TRUE(replay.player().finished());
+
+    merged = merge.merge(1, rendered);
+    ASSERT_NE(merged, nullptr);
+    EXPECT_EQ(merged->address(100), (show_frames - 1) / 4);
+
+    // Closing releases everything the show set.
+    replay.close();
+    merged = merge.merge(1, rendered);
+    EXPECT_EQ(merged ? merged->address(100) : rendered.address(100), 0);
+
+    // Destroying the replay destroys its merge source.
+    EXPECT_EQ(merge.sources().size(), 1);
+    replay_source.reset();
+    EXPECT_TRUE(merge.sources().empty());
+}
+
+TEST_F(Replay, Restart) {
+    ASSERT_TRUE(monet::recording::encode_show_file(m_recording, m_show_path));
+
+    monet::address::merge_engine merge;
+    monet::address::universe rendered;
+    monet::source::replay replay(merge);
+
+    ASSERT_TRUE(replay.open(m_show_path));
+
+    auto const play_to_end = [&] {
+        ASSERT_TRUE(replay.start(0.0));
+
+        for (auto const deadline = std::chrono::steady_clock::now() + 5s; replay.playing() && std::chrono::steady_clock::now() < deadline;) {
+            std::this_thread::sleep_for(1ms);
+        }
+
+        EXPECT_FALSE(replay.playing());
+        EXPECT_TRUE(replay.player().finished());
+    };
+
+    play_to_end();
+
+    // Seeking back after the show ended plays it again without stopping first.
+    replay.seek(0ns);
+    EXPECT_EQ(merge.merge(1, rendered)->address(100), 0);
+
+    play_to_end();
+    EXPECT_EQ(merge.merge(1, rendered)->address(100), (show_frames - 1) / 4);
+}
@@ -0,0 +1,127 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+    /// Port the tests receive on, away from the default so a console on the machine does not interfere.
+    constexpr uint16_t test_port = 15568;
+
+    /// Sends sACN packets to the receiver over loopback.
+    class SacnReceiver : public testing::Test {
+    protected:
+        monet::address::merge_engine m_merge;
+        monet::source::sacn m_receiver{m_merge, 2};
+        monet::address::universe m_rendered;
+        int m_socket = -1;
+        e131_addr_t m_destination{};
+
+        void SetUp() override {
+            m_socket = e131_socket();
+            ASSERT_GE(m_socket, 0);
+            ASSERT_EQ(e131_unicast_dest(&m_destination, "127.0.0.1", test_port), 0);
+
+            std::array<size_t, 2> const universes{ 1, 2 };
+            ASSERT_TRUE(m_receiver.start(universes, test_port));
+        }
+
+        void TearDown() override {
+            m_receiver.stop();
+            close(m_socket);
+        }
+
+        /// Send a packet with the first address set to a value.
+        void send(uint8_t const a_cid, uint16_t const a_universe, uint8_t const a_sequence, uint8_t const a_value, uint8_t const a_options = 0, uint8_t const a_priority = monet::default_merge_priority) {
+            e131_packet_t packet;
+            e131_pkt_init(&packet, a_universe, 4);
+
+            packet.root.cid[0] = a_cid;
+            packet.frame.priority = a_priority;
+            packet.frame.seq_number = a_sequence;
+            packet.frame.options = a_options;
+            packet.dmp.prop_val[1] = a_value;
+
+            e131_send(m_socket, &packet, &m_destination);
+        }
+
+        /// Wait until the receiver has taken a packet count, then return the merged first address of a universe.
+        uint8_t merged_value(size_t const a_received_packets, size_t const a_universe = 1) {
+            for (auto const deadline = std::chrono::steady_clock::now() + 2s; std::chrono::steady_clock::now() < deadline;) {
+                if (m_receiver.received_packets() >= a_received_packets) {
+                    break;
+                }
+
+                std::this_thread::sleep_for(1ms);
+            }
+
+            auto const* const merged = m_merge.merge(a_universe, m_rendered);
+            return merged ? merged->address(1) : m_rendered.address(1);
+        }
+    };
+
+}
+
+TEST_F(SacnReceiver, Receive) {
+    send(1, 1, 0, 100);
+    EXPECT_EQ(merged_value(1), 100);
+
+    // Universes not configured are ignored.
+    send(1, 3, 1, 200);
+    EXPECT_EQ(merged_value(2, 3), 0);
+
+    // Two remote sources at the same priority merge HTP.
+    send(2, 1, 0, 150);
+    EXPECT_EQ(merged_value(3), 150);
+
+    send(1, 1, 1, 180);
+    EXPECT_EQ(merged_value(4), 180);
+
+    // A third remote source has no free slot.
+    send(3, 1, 0, 255);
+    EXPECT_EQ(merged_value(5), 180);
+    EXPECT_EQ(m_receiver.dropped_packets(), 1);
+
+    // Terminating a stream hands the universe back.
+    send(1, 1, 2, 180, 1 << E131_OPT_TERMINATED);
+    EXPECT_EQ(merged_value(6), 150);
+}
+
+TEST_F(SacnReceiver, Validation) {
+    send(1, 1, 10, 100);
+    EXPECT_EQ(merged_value(1), 100);
+
+    // Packets older than the last one received are discarded.
+    send(1, 1, 5, 50);
+    EXPECT_EQ(merged_value(2), 100);
+    EXPECT_EQ(m_receiver.out_of_sequence_packets(), 1);
+
+    // Newer packets are accepted again.
+    send(1, 1, 11, 60);
+    EXPECT_EQ(merged_value(3), 60);
+
+    std::array<uint8_t, 16> const garbage{ 'n', 'o', 't', ' ', 's', 'A', 'C', 'N' };
+    e131_addr_t const destination = m_destination;
+    sendto(m_socket, garbage.data(), garbage.size(), 0, reinterpret_cast<sockaddr const*>(&destination), sizeof(destination));
+
+    EXPECT_EQ(merged_value(4), 60);
+    EXPECT_EQ(m_receiver.invalid_packets(), 1);
+}
+
+TEST_F(SacnReceiver, UniversePriorities) {
+    m_rendered.set_address(1, 200);
+
+    // One remote source sending universe 1 below the local output and universe 2 above it.
+    send(1, 1, 0, 50, 0, 50);
+    EXPECT_EQ(merged_value(1, 1), 200);
+
+    send(1, 2, 0, 50, 0, 150);
+    EXPECT_EQ(merged_value(2, 2), 50);
+    EXPECT_EQ(merged_value(2, 1), 200);
+}
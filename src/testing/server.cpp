@@ -76,4 +76,598 @@ TEST_F(Server, Universes) {
         EXPECT_EQ(m_server.get_address_value(universe, address), value2);
         EXPECT_EQ(m_server.get_address_value(master), value2);
     }
-}
\ No newline at end of file
+}
+
+TEST_F(Server, UniverseTable) {
+    auto& universes = m_server.universes();
+
+    auto& first = m_server.create_universe(12);
+    first.set_address(1, 77);
+
+    // Allocate past the first chunk of slots; existing universes must not move.
+    for (size_t i = 0; i < monet::address::universe_table::chunk_size * 2; ++i) {
+        m_server.create_universe(100 + i);
+    }
+
+    EXPECT_EQ(&m_server.get_universe(12), &first);
+    EXPECT_EQ(m_server.get_address_value(12, 1), 77);
+    EXPECT_EQ(universes.size(), monet::address::universe_table::chunk_size * 2 + 1);
+
+    // Universes are iterated in order of creation.
+    size_t expected = 12;
+    for (auto [universe_number, universe] : universes) {
+        EXPECT_EQ(universe_number, expected);
+        EXPECT_EQ(&universe, m_server.fetch_universe(universe_number).value());
+        expected = expected == 12 ? 100 : expected + 1;
+    }
+
+    // Universe numbers outside of the sACN range.
+    EXPECT_FALSE(m_server.fetch_universe(0).has_value());
+    EXPECT_FALSE(m_server.fetch_universe(64000).has_value());
+    EXPECT_THROW(m_server.create_universe(0), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(m_server.get_universe(64000)), std::out_of_range);
+    EXPECT_EQ(m_server.get_address_value(64000, 1), 0);
+
+    m_server.create_universe(monet::max_universe_number).set_address(512, 3);
+    EXPECT_EQ(m_server.get_address_value(monet::address::to_master_address(monet::max_universe_number, 512)), 3);
+}
+
+namespace {
+
+    /// Sink that records which universes were sent.
+    class counting_sink : public monet::sink::sink {
+    public:
+        std::vector<size_t> sent;
+
+        counting_sink() noexcept :
+            sink("counting")
+        {}
+
+        void send_universe(size_t const a_universe_number, monet::address::universe const&) override {
+            sent.push_back(a_universe_number);
+        }
+    };
+
+}
+
+TEST_F(Server, ChangeDrivenOutput) {
+    using namespace std::chrono_literals;
+
+    auto* sink = new counting_sink;
+    sink->set_unchanged_repeats(1);
+    sink->set_keep_alive_interval(1h);
+    m_server.set_sink_interface(sink);
+
+    m_server.create_universe(1);
+    m_server.create_universe(2);
+
+    // New universes are output once and repeated once.
+    m_server.poll();
+    m_server.poll();
+    EXPECT_EQ(sink->sent, (std::vector<size_t>{ 1, 2, 1, 2 }));
+
+    sink->sent.clear();
+    m_server.poll();
+    EXPECT_TRUE(sink->sent.empty());
+
+    // Only the changed universe is output.
+    m_server.set_address_value(2, 40, 255);
+    m_server.poll();
+    EXPECT_EQ(sink->sent, std::vector<size_t>{ 2 });
+    EXPECT_FALSE(m_server.get_universe(2).dirty());
+
+    // A changed universe is repeated, then no longer output while it stays unchanged.
+    sink->sent.clear();
+    m_server.poll();
+    m_server.poll();
+    EXPECT_EQ(sink->sent, std::vector<size_t>{ 2 });
+
+    // Keep-alive resends unchanged universes once the interval has passed since they were last output.
+    sink->sent.clear();
+    sink->set_keep_alive_interval(100ms);
+    m_server.poll();
+    EXPECT_TRUE(sink->sent.empty());
+
+    std::this_thread::sleep_for(110ms);
+    m_server.poll();
+    EXPECT_EQ(sink->sent, (std::vector<size_t>{ 1, 2 }));
+
+    sink->sent.clear();
+    sink->set_keep_alive_interval(0ms);
+    m_server.poll();
+    EXPECT_EQ(sink->sent, (std::vector<size_t>{ 1, 2 }));
+}
+
+TEST_F(Server, RenderOutputStages) {
+    auto* sink = new counting_sink;
+    m_server.set_sink_interface(sink);
+
+    m_server.create_universe(1);
+
+    // Rendered frames queue up until the output stage runs; the output stage only sends the newest.
+    m_server.set_address_value(1, 1, 10);
+    m_server.render_frame();
+    m_server.set_address_value(1, 1, 20);
+    m_server.render_frame();
+
+    m_server.output_frame();
+    EXPECT_EQ(sink->sent, std::vector<size_t>{ 1 });
+
+    // Rendering stalls; output continues from the last snapshot.
+    sink->sent.clear();
+    m_server.output_frame();
+    EXPECT_EQ(sink->sent, std::vector<size_t>{ 1 });
+
+    // Output stalls; rendering carries on and the sink skips the frames it never output.
+    for (size_t i = 0; i < 4; ++i) {
+        m_server.render_frame();
+    }
+
+    m_server.output_frame();
+
+    auto const& output = *m_server.sink_outputs().front();
+    EXPECT_EQ(m_server.dropped_frames(), 0);
+    EXPECT_EQ(output.skipped_frames(), 3);
+    EXPECT_EQ(output.output_frames(), 3);
+}
+
+TEST_F(Server, MultipleSinks) {
+    auto* all = new counting_sink;
+    auto* routed = new counting_sink;
+
+    m_server.add_sink(all);
+    auto& routed_output = m_server.add_sink(routed, 30);
+
+    std::array<size_t, 2> const routes{ 2, 3 };
+    routed_output.set_routes(routes);
+
+    EXPECT_EQ(m_server.sink_outputs().size(), 2);
+    EXPECT_EQ(m_server.sink_interface(), all);
+    EXPECT_EQ(routed_output.scheduler().framerate(), 30);
+
+    m_server.create_universe(1);
+    m_server.create_universe(2);
+
+    // Both sinks output the same snapshot, each through its own routes.
+    m_server.poll();
+    EXPECT_EQ(all->sent, (std::vector<size_t>{ 1, 2 }));
+    EXPECT_EQ(routed->sent, std::vector<size_t>{ 2 });
+
+    EXPECT_TRUE(m_server.remove_sink(all));
+    EXPECT_FALSE(m_server.remove_sink(all));
+    EXPECT_EQ(m_server.sink_interface(), routed);
+
+    routed->sent.clear();
+    m_server.set_address_value(2, 1, 10);
+    m_server.poll();
+    EXPECT_EQ(routed->sent, std::vector<size_t>{ 2 });
+}
+
+namespace {
+
+    /// Sink that records the universe each universe number was output from.
+    class source_sink : public monet::sink::sink {
+    public:
+        std::map<size_t, monet::address::universe const*> sources;
+
+        source_sink() noexcept :
+            sink("source")
+        {}
+
+        void send_universe(size_t const a_universe_number, monet::address::universe const& a_universe) override {
+            sources[a_universe_number] = &a_universe;
+        }
+    };
+
+}
+
+TEST_F(Server, OutputRouting) {
+    using namespace std::chrono_literals;
+
+    auto* sink = new source_sink;
+    m_server.set_sink_interface(sink);
+
+    auto& output = *m_server.sink_outputs().front();
+
+    // Mirror universe 1 to 6, and move universes 10-12 to 110-112.
+    output.add_route(1, 1);
+    output.add_route(1, 6);
+    output.add_routes(10, 3, 110);
+
+    EXPECT_THROW(output.add_route(0, 1), std::out_of_range);
+    EXPECT_THROW(output.add_route(1, monet::max_universe_number + 1), std::out_of_range);
+
+    EXPECT_EQ(output.routes(1).size(), 2);
+    EXPECT_TRUE(output.routed(11));
+    EXPECT_FALSE(output.routed(2));
+
+    for (auto const universe_number : { 1, 2, 10, 11, 12 }) {
+        m_server.create_universe(universe_number);
+    }
+
+    m_server.poll();
+
+    std::vector<size_t> sent;
+
+    for (auto const& [universe_number, source] : sink->sources) {
+        sent.push_back(universe_number);
+    }
+
+    EXPECT_EQ(sent, (std::vector<size_t>{ 1, 6, 110, 111, 112 }));
+
+    // Mirrors are the same snapshot universe, not copies.
+    EXPECT_EQ(sink->sources[1], sink->sources[6]);
+    EXPECT_NE(sink->sources[110], sink->sources[111]);
+
+    // Without routes, every universe is output as itself.
+    sink->sources.clear();
+    sink->set_keep_alive_interval(0ms);
+    output.clear_routes();
+    m_server.poll();
+
+    EXPECT_EQ(sink->sources.size(), 5);
+    EXPECT_TRUE(sink->sources.contains(2));
+    EXPECT_FALSE(sink->sources.contains(6));
+}
+
+TEST_F(Server, Threaded) {
+    using namespace std::chrono_literals;
+
+    auto* sink = new counting_sink;
+    sink->set_keep_alive_interval(0ms);
+
+    m_server.set_sink_interface(sink);
+    m_server.set_sink_framerate(200);
+    m_server.create_universe(1);
+
+    m_server.start();
+    std::this_thread::sleep_for(100ms);
+    m_server.stop();
+
+    EXPECT_GT(sink->sent.size(), 5);
+}
+
+TEST_F(Server, ThreadedChanges) {
+    using namespace std::chrono_literals;
+
+    auto& config = m_server.channel_configuration("dimmer");
+    config.add_attribute("intensity", monet::channel::attribute_definition("Intensity"));
+    config.address_mappings().emplace_back("intensity", 0);
+
+    m_server.set_sink_interface(new counting_sink);
+    m_server.set_sink_framerate(200);
+    m_server.start();
+
+    using type = monet::command::command_type;
+
+    // Channels and sinks change from another thread, like the web panel, while the render thread runs.
+    std::thread control([&] {
+        for (size_t i = 1; i <= 50; ++i) {
+            m_server.create_channel(i, "dimmer", i);
+            m_server.enqueue_command({ .type = type::set_attribute_value, .target = i, .attribute_type = "intensity", .value = 255 });
+
+            if (i % 2 == 0) {
+                m_server.delete_channel(i - 1);
+            }
+
+            if (i % 10 == 0) {
+                auto* const sink = new counting_sink;
+                m_server.add_sink(sink);
+                m_server.remove_sink(sink);
+            }
+
+            std::this_thread::sleep_for(1ms);
+        }
+    });
+
+    control.join();
+    std::this_thread::sleep_for(20ms);
+
+    {
+        auto const lock = m_server.lock_channels();
+        EXPECT_EQ(m_server.channels().size(), 25);
+    }
+
+    m_server.stop();
+
+    EXPECT_EQ(m_server.sink_outputs().size(), 1);
+    EXPECT_EQ(m_server.get_address_value(50), 255);
+    EXPECT_EQ(m_server.channel_number(*m_server.channel_by_number(50)), 50);
+}
+
+namespace {
+
+    /// Sink that takes longer than a frame to send, like one hitting a congested unicast target.
+    class slow_sink : public counting_sink {
+    public:
+        void send_universe(size_t const a_universe_number, monet::address::universe const& a_universe) override {
+            std::this_thread::sleep_for(std::chrono::milliseconds(40));
+            counting_sink::send_universe(a_universe_number, a_universe);
+        }
+    };
+
+}
+
+TEST_F(Server, SlowSinkIsolation) {
+    using namespace std::chrono_literals;
+
+    auto* fast = new counting_sink;
+    auto* slow = new slow_sink;
+    fast->set_keep_alive_interval(0ms);
+    slow->set_keep_alive_interval(0ms);
+
+    m_server.set_sink_framerate(200);
+    m_server.add_sink(fast);
+    m_server.add_sink(slow);
+    m_server.create_universe(1);
+
+    m_server.start();
+    std::this_thread::sleep_for(200ms);
+    m_server.stop();
+
+    auto const& fast_output = *m_server.sink_outputs()[0];
+    auto const& slow_output = *m_server.sink_outputs()[1];
+
+    // The slow sink only holds itself up.
+    EXPECT_GT(fast->sent.size(), 2 * slow->sent.size());
+    EXPECT_GT(slow_output.skipped_frames(), fast_output.skipped_frames());
+    EXPECT_GE(slow_output.max_latency(), 40ms);
+    EXPECT_EQ(m_server.dropped_frames(), 0);
+}
+
+TEST_F(Server, Commands) {
+    auto& config = m_server.channel_configuration("rgb");
+    config.add_attribute("intensity", monet::channel::attribute_definition("Intensity"));
+    config.add_attribute("rgb_color", monet::channel::attribute_definition("Color"));
+    config.address_mappings().emplace_back("intensity", 0);
+    config.address_mappings().emplace_back("rgb_color", 0, "red");
+
+    m_server.create_channel(1, "rgb", 10);
+
+    using type = monet::command::command_type;
+
+    EXPECT_TRUE(m_server.enqueue_command({ .type = type::set_attribute_value, .target = 1, .attribute_type = "intensity", .value = 200 }));
+    EXPECT_TRUE(m_server.enqueue_command({ .type = type::set_attribute_value, .target = 1, .attribute_type = "rgb_color", .attribute_channel = "red", .value = 50 }));
+    EXPECT_TRUE(m_server.enqueue_command({ .type = type::set_address_value, .target = 600, .value = 7 }));
+
+    // Invalid targets are ignored.
+    EXPECT_TRUE(m_server.enqueue_command({ .type = type::set_attribute_value, .target = 2, .attribute_type = "intensity", .value = 1 }));
+    EXPECT_TRUE(m_server.enqueue_command({ .type = type::set_attribute_value, .target = 1, .attribute_type = "intensity", .attribute_index = 3, .value = 1 }));
+
+    // Nothing is applied until the next frame is rendered.
+    EXPECT_EQ(m_server.get_address_value(10), 0);
+
+    m_server.render_frame();
+
+    EXPECT_EQ(m_server.get_address_value(10), 200);
+    EXPECT_EQ(m_server.get_address_value(11), 50);
+    EXPECT_EQ(m_server.get_address_value(600), 7);
+}
+
+TEST_F(Server, ParallelRender) {
+    auto& config = m_server.channel_configuration("rgb");
+    config.add_attribute("rgb_color", monet::channel::attribute_definition("Color"));
+    config.address_mappings().emplace_back("rgb_color", 0, "red");
+    config.address_mappings().emplace_back("rgb_color", 0, "green");
+    config.address_mappings().emplace_back("rgb_color", 0, "blue");
+
+    monet::server serial;
+    auto& serial_config = serial.channel_configuration("rgb");
+    serial_config.add_attribute("rgb_color", monet::channel::attribute_definition("Color"));
+    serial_config.address_mappings().emplace_back("rgb_color", 0, "red");
+    serial_config.address_mappings().emplace_back("rgb_color", 0, "green");
+    serial_config.address_mappings().emplace_back("rgb_color", 0, "blue");
+
+    using monet::channel::attribute::rgb_color;
+
+    // 16 universes of 170 RGB channels each.
+    for (size_t i = 0; i < 16 * 170; ++i) {
+        auto const base_address = (i / 170) * monet::dmx_data_channel_count + (i % 170) * 3 + 1;
+
+        for (auto* server : { &m_server, &serial }) {
+            auto& color = server->create_channel(i + 1, "rgb", base_address).attributes("rgb_color")[0];
+            color->set_value(rgb_color::red,   static_cast<uint8_t>(i));
+            color->set_value(rgb_color::green, static_cast<uint8_t>(i >> 8));
+            color->set_value(rgb_color::blue,  static_cast<uint8_t>(i * 7));
+        }
+    }
+
+    m_server.set_render_threads(4);
+    ASSERT_EQ(m_server.render_threads(), 4);
+
+    m_server.render_all_channels();
+    serial.render_all_channels();
+
+    ASSERT_EQ(m_server.universes().size(), 16);
+
+    for (auto const& [number, universe] : serial.universes()) {
+        auto const* parallel_universe = m_server.universes().find(number);
+
+        ASSERT_NE(parallel_universe, nullptr);
+        EXPECT_TRUE(std::equal(
+            universe.buffer(), universe.buffer() + monet::universe_buffer_size, parallel_universe->buffer()
+        )) << "Universe " << number;
+    }
+
+    // Deleted channels are dropped from the render queue.
+    m_server.mark_for_render(*m_server.channels().at(1));
+    m_server.delete_channel(1);
+    m_server.render_channels();
+}
+
+TEST_F(Server, FadeCommand) {
+    using namespace std::chrono_literals;
+
+    auto& config = m_server.channel_configuration("dimmer");
+    config.add_attribute("intensity", monet::channel::attribute_definition("Intensity"));
+    config.address_mappings().emplace_back("intensity", 0);
+
+    m_server.create_channel(1, "dimmer", 1);
+
+    using type = monet::command::command_type;
+
+    EXPECT_TRUE(m_server.enqueue_command({ .type = type::set_attribute_value, .target = 1, .attribute_type = "intensity", .value = 255, .fade_time = 200ms }));
+
+    m_server.render_frame();
+    EXPECT_EQ(m_server.fades().size(), 1);
+    EXPECT_LT(m_server.get_address_value(1), 255);
+
+    std::this_thread::sleep_for(250ms);
+    m_server.render_frame();
+
+    // The fade has finished, the final value has been rendered, and the fade has been retired.
+    EXPECT_EQ(m_server.fades().size(), 0);
+    EXPECT_EQ(m_server.get_address_value(1), 255);
+
+    // Deleting a channel stops its fades.
+    EXPECT_TRUE(m_server.enqueue_command({ .type = type::set_attribute_value, .target = 1, .attribute_type = "intensity", .value = 0, .fade_time = 1s }));
+    m_server.render_frame();
+    EXPECT_EQ(m_server.fades().size(), 1);
+
+    m_server.delete_channel(1);
+    EXPECT_EQ(m_server.fades().size(), 0);
+}
+
+TEST_F(Server, Effects) {
+    auto& config = m_server.channel_configuration("dimmer");
+    config.add_attribute("intensity", monet::channel::attribute_definition("Intensity"));
+    config.address_mappings().emplace_back("intensity", 0);
+
+    auto& effect = m_server.effects().create(monet::effect_waveform::square, 1.0f, 0, 65535, 0.5f);
+
+    for (size_t i = 1; i <= 2; ++i) {
+        auto& channel = m_server.create_channel(i, "dimmer", i);
+        effect.add_member(channel, *channel.attributes("intensity")[0], monet::channel::attribute::attribute::base);
+    }
+
+    effect.restart();
+    m_server.render_frame();
+
+    // Half a period apart: one on, one off, rendered without any command.
+    EXPECT_EQ(m_server.get_address_value(1), 255);
+    EXPECT_EQ(m_server.get_address_value(2), 0);
+    EXPECT_GT(m_server.render_time().count(), 0);
+    EXPECT_LE(m_server.effect_time(), m_server.render_time());
+
+    m_server.delete_channel(1);
+    EXPECT_EQ(effect.members().size(), 1);
+}
+
+TEST_F(Server, CueCommands) {
+    auto& config = m_server.channel_configuration("dimmer");
+    config.add_attribute("intensity", monet::channel::attribute_definition("Intensity"));
+    config.address_mappings().emplace_back("intensity", 0);
+
+    auto& channel = m_server.create_channel(1, "dimmer", 1);
+    auto* intensity = channel.attributes("intensity")[0].get();
+
+    auto& stack = m_server.create_cue_stack("Main");
+    stack.add_cue({ .name = "1", .values = { { &channel, intensity, monet::channel::attribute::attribute::base, 65535 } } });
+    stack.add_cue({ .name = "2", .values = { { &channel, intensity, monet::channel::attribute::attribute::base, 0 } } });
+
+    using type = monet::command::command_type;
+
+    // GO is rendered in the same frame it is applied.
+    EXPECT_TRUE(m_server.enqueue_command({ .type = type::go_cue, .target = 0 }));
+    m_server.render_frame();
+    EXPECT_EQ(m_server.get_address_value(1), 255);
+
+    EXPECT_TRUE(m_server.enqueue_command({ .type = type::go_cue, .target = 0 }));
+    m_server.render_frame();
+    EXPECT_EQ(m_server.get_address_value(1), 0);
+
+    EXPECT_TRUE(m_server.enqueue_command({ .type = type::go_to_cue, .target = 0, .cue_index = 0 }));
+    m_server.render_frame();
+    EXPECT_EQ(m_server.get_address_value(1), 255);
+
+    // Unknown cue stacks are ignored.
+    EXPECT_TRUE(m_server.enqueue_command({ .type = type::go_cue, .target = 5 }));
+    m_server.render_frame();
+
+    m_server.delete_channel(1);
+    EXPECT_TRUE(stack.cues()[0].values.empty());
+}
+
+namespace {
+
+    /// Sink that records the value of the first address of every universe sent.
+    class recording_sink : public monet::sink::sink {
+    public:
+        std::map<size_t, uint8_t> values;
+
+        recording_sink() noexcept :
+            sink("recording")
+        {}
+
+        void send_universe(size_t const a_universe_number, monet::address::universe const& a_universe) override {
+            values[a_universe_number] = a_universe.address(1);
+        }
+    };
+
+}
+
+TEST_F(Server, MergedOutput) {
+    auto* sink = new recording_sink;
+    m_server.set_sink_interface(sink);
+
+    m_server.create_universe(1);
+    m_server.create_universe(2);
+    m_server.set_address_value(1, 1, 100);
+    m_server.set_address_value(2, 1, 100);
+
+    // A manual override runs on top of the rendered output without touching the universe table.
+    auto& manual = m_server.merge().create_source("Manual", 200);
+    manual.set_address(1, 1, 30);
+
+    m_server.poll();
+    EXPECT_EQ(sink->values[1], 30);
+    EXPECT_EQ(sink->values[2], 100);
+    EXPECT_EQ(m_server.get_address_value(1, 1), 100);
+
+    // Releasing the override hands the address back to the render output.
+    manual.release(1);
+    m_server.poll();
+    EXPECT_EQ(sink->values[1], 100);
+
+    m_server.set_address_value(1, 1, 120);
+    m_server.poll();
+    EXPECT_EQ(sink->values[1], 120);
+}
+
+TEST_F(Server, OutputStage) {
+    auto* sink = new recording_sink;
+    m_server.set_sink_interface(sink);
+
+    auto& config = m_server.channel_configuration("dimmer");
+    config.add_attribute("intensity", monet::channel::attribute_definition("Intensity", { { "invert", "true" } }));
+    config.address_mappings().emplace_back("intensity", 0);
+
+    auto& channel = m_server.create_channel(1, "dimmer", 1);
+    channel.attributes("intensity")[0]->set_value(monet::channel::attribute::attribute::base, 255);
+    m_server.render_all_channels();
+
+    // Output is transformed; the universe table keeps the rendered values.
+    m_server.poll();
+    EXPECT_EQ(sink->values[1], 0);
+    EXPECT_EQ(m_server.get_address_value(1), 255);
+    EXPECT_TRUE(m_server.output_stage().transform(1, 1).mastered);
+
+    using type = monet::command::command_type;
+
+    EXPECT_TRUE(m_server.enqueue_command({ .type = type::set_grand_master, .value = 0 }));
+    m_server.poll();
+    EXPECT_EQ(sink->values[1], 255);
+
+    // Modified properties are picked up by the next frame.
+    EXPECT_TRUE(config.set_attribute_property("intensity", 0, "invert", "false"));
+    m_server.poll();
+    EXPECT_EQ(sink->values[1], 0);
+
+    EXPECT_TRUE(m_server.enqueue_command({ .type = type::set_grand_master, .value = 255 }));
+    m_server.poll();
+    EXPECT_EQ(sink->values[1], 255);
+
+    m_server.delete_channel(1);
+    m_server.poll();
+    EXPECT_TRUE(m_server.output_stage().transform(1, 1).identity());
+}
@@ -0,0 +1,193 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <string>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <monet.hpp>
+#include <gtest/gtest.h>
+
+namespace {
+
+    constexpr size_t test_universes = 4;
+    constexpr size_t test_frames = 20000;
+
+    /// A segment name of the test process's own, so parallel test runs do not share it.
+    std::string segment_name() {
+        return "/monet-test-" + std::to_string(getpid());
+    }
+
+    /**
+     * Read the segment from another process until the last frame is published.
+     *
+     * @return The exit status: 0 if every snapshot was consistent, 1 for a torn or out of order snapshot, 2 if the
+     *         segment could not be opened.
+     */
+    int read_segment(char const* const a_name, int const a_ready) {
+        monet::shared_universes::reader reader;
+
+        if (!reader.open(a_name)) {
+            return 2;
+        }
+
+        // Let the writer start only once the reader is reading.
+        char const ready = 1;
+
+        if (write(a_ready, &ready, 1) != 1) {
+            return 2;
+        }
+
+        std::array<uint64_t, test_universes + 1> last_frames{};
+        monet::shared_universes::universe_snapshot snapshot{};
+
+        while (reader.frame() < test_frames) {
+            for (size_t universe = 1; universe <= test_universes; ++universe) {
+                if (!reader.read(universe, snapshot)) {
+                    continue;
+                }
+
+                // Every frame sets every address of a universe to one value.
+                for (size_t address = 2; address <= monet::dmx_data_channel_count; ++address) {
+                    if (snapshot.data[address] != snapshot.data[1]) {
+                        return 1;
+                    }
+                }
+
+                if (snapshot.frame < last_frames[universe] || snapshot.data[1] != static_cast<uint8_t>(snapshot.frame)) {
+                    return 1;
+                }
+
+                last_frames[universe] = snapshot.frame;
+            }
+        }
+
+        return 0;
+    }
+
+}
+
+TEST(SharedUniverses, Export) {
+    monet::server server;
+    monet::sink::shared_memory sink(segment_name());
+
+    server.create_universe(1).set_address(1, 10);
+    server.create_universe(3).set_address(512, 30);
+
+    ASSERT_TRUE(sink.initialize(server));
+
+    monet::shared_universes::reader reader;
+    ASSERT_TRUE(reader.open(sink.name().c_str()));
+    EXPECT_EQ(reader.frame(), 0);
+    EXPECT_EQ(reader.sequence(1), 0);
+
+    std::array<monet::sink::frame_universe, 2> const frame{{
+        { 1, &server.get_universe(1) },
+        { 3, &server.get_universe(3) }
+    }};
+
+    sink.send_frame(frame);
+    EXPECT_EQ(reader.frame(), 1);
+    EXPECT_EQ(reader.sequence(1), 2);
+
+    monet::shared_universes::universe_snapshot snapshot{};
+    ASSERT_TRUE(reader.read(1, snapshot));
+    EXPECT_EQ(snapshot.frame, 1);
+    EXPECT_EQ(snapshot.address_count, 2);
+    EXPECT_EQ(snapshot.data[1], 10);
+
+    ASSERT_TRUE(reader.read(3, snapshot));
+    EXPECT_EQ(snapshot.address_count, monet::universe_buffer_size);
+    EXPECT_EQ(snapshot.data[512], 30);
+
+    // Universes never written and invalid universe numbers have no snapshot.
+    EXPECT_FALSE(reader.read(2, snapshot));
+    EXPECT_FALSE(reader.read(0, snapshot));
+    EXPECT_FALSE(reader.read(monet::max_universe_number + 1, snapshot));
+
+    sink.deinitialize();
+
+    // The segment is removed, though the reader keeps its mapping.
+    monet::shared_universes::reader late_reader;
+    EXPECT_FALSE(late_reader.open(sink.name().c_str()));
+    EXPECT_EQ(reader.frame(), 1);
+}
+
+TEST(SharedUniverses, LeftoverSegment) {
+    monet::server server;
+    server.create_universe(1).set_address(1, 10);
+
+    std::array<monet::sink::frame_universe, 1> const frame{{
+        { 1, &server.get_universe(1) }
+    }};
+
+    // A writer that never removed its segment, as after a crash, with a reader still mapping it.
+    monet::sink::shared_memory crashed(segment_name());
+    ASSERT_TRUE(crashed.initialize(server));
+    crashed.send_frame(frame);
+
+    monet::shared_universes::reader reader;
+    ASSERT_TRUE(reader.open(crashed.name().c_str()));
+
+    monet::sink::shared_memory sink(segment_name());
+    ASSERT_TRUE(sink.initialize(server));
+
+    // The reader keeps the old segment intact until it reopens the new one.
+    monet::shared_universes::universe_snapshot snapshot{};
+    EXPECT_EQ(reader.frame(), 1);
+    ASSERT_TRUE(reader.read(1, snapshot));
+    EXPECT_EQ(snapshot.data[1], 10);
+
+    ASSERT_TRUE(reader.open(sink.name().c_str()));
+    EXPECT_EQ(reader.frame(), 0);
+    EXPECT_FALSE(reader.read(1, snapshot));
+}
+
+TEST(SharedUniverses, SeparateProcesses) {
+    monet::server server;
+    monet::sink::shared_memory sink(segment_name());
+    std::vector<monet::address::universe*> universes;
+    std::vector<monet::sink::frame_universe> frame;
+
+    for (size_t universe_number = 1; universe_number <= test_universes; ++universe_number) {
+        auto& universe = server.create_universe(universe_number);
+        universes.push_back(&universe);
+        frame.push_back({ universe_number, &universe });
+    }
+
+    ASSERT_TRUE(sink.initialize(server));
+
+    int ready[2];
+    ASSERT_EQ(pipe(ready), 0);
+
+    auto const reader_process = fork();
+    ASSERT_GE(reader_process, 0);
+
+    if (reader_process == 0) {
+        close(ready[0]);
+        _exit(read_segment(sink.name().c_str(), ready[1]));
+    }
+
+    close(ready[1]);
+
+    char signal = 0;
+    ASSERT_EQ(read(ready[0], &signal, 1), 1);
+    close(ready[0]);
+
+    for (size_t i = 1; i <= test_frames; ++i) {
+        for (auto* const universe : universes) {
+            std::ranges::fill(universe->address_range(1, monet::dmx_data_channel_count), static_cast<uint8_t>(i));
+        }
+
+        sink.send_frame(frame);
+    }
+
+    int status = 0;
+    ASSERT_EQ(waitpid(reader_process, &status, 0), reader_process);
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+
+    EXPECT_EQ(sink.frame_count(), test_frames);
+}
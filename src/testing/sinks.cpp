@@ -0,0 +1,217 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+    /// Open a socket listening for sACN on the given universes with a receive timeout.
+    int open_sacn_receiver(std::initializer_list<uint16_t> const a_universes) {
+        int const socket_id = e131_socket();
+
+        timeval timeout{ .tv_sec = 1, .tv_usec = 0 };
+        setsockopt(socket_id, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+        e131_bind(socket_id, E131_DEFAULT_PORT);
+
+        for (auto const universe : a_universes) {
+            e131_multicast_join(socket_id, universe);
+        }
+
+        return socket_id;
+    }
+
+}
+
+TEST(Sinks, SACNFrame) {
+    monet::server server;
+
+    int const receiver = open_sacn_receiver({ 3, 5 });
+    ASSERT_GE(receiver, 0);
+
+    monet::sink::sacn sacn("Test Source");
+    ASSERT_TRUE(sacn.initialize(server));
+
+    auto& universe3 = server.get_universe(3);
+    auto& universe5 = server.get_universe(5);
+    universe3.set_address(1, 33);
+    universe5.set_address(512, 55);
+
+    std::array<monet::sink::frame_universe, 2> const frame{{
+        { 3, &universe3 },
+        { 5, &universe5 }
+    }};
+
+    sacn.send_frame(frame);
+
+    std::map<uint16_t, e131_packet_t> received;
+
+    for (int i = 0; i < 2; ++i) {
+        e131_packet_t packet{};
+        ASSERT_GT(e131_recv(receiver, &packet), 0);
+        ASSERT_EQ(e131_pkt_validate(&packet), E131_ERR_NONE);
+
+        received[ntohs(packet.frame.universe)] = packet;
+    }
+
+    // Each universe is sent to its own multicast group.
+    ASSERT_TRUE(received.contains(3));
+    ASSERT_TRUE(received.contains(5));
+
+    EXPECT_EQ(received[3].dmp.prop_val[1], 33);
+    EXPECT_EQ(received[5].dmp.prop_val[512], 55);
+    EXPECT_EQ(received[3].frame.seq_number, 0);
+
+    // Sequence numbers advance per universe.
+    sacn.send_frame(std::span(frame).first(1));
+
+    e131_packet_t packet{};
+    ASSERT_GT(e131_recv(receiver, &packet), 0);
+    EXPECT_EQ(ntohs(packet.frame.universe), 3);
+    EXPECT_EQ(packet.frame.seq_number, 1);
+
+    close(receiver);
+}
+
+TEST(Sinks, ArtNetFrame) {
+    // Away from the Art-Net port, so the sink cannot bind it and a node on the machine does not interfere.
+    constexpr uint16_t test_port = 16454;
+
+    monet::server server;
+
+    int const receiver = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    ASSERT_GE(receiver, 0);
+
+    timeval timeout{ .tv_sec = 1, .tv_usec = 0 };
+    setsockopt(receiver, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    sockaddr_in local{ .sin_family = AF_INET, .sin_port = htons(test_port) };
+    inet_pton(AF_INET, "127.0.0.1", &local.sin_addr);
+    ASSERT_EQ(bind(receiver, reinterpret_cast<sockaddr const*>(&local), sizeof(local)), 0);
+
+    // No broadcast address, so only universes with a node are sent.
+    monet::sink::artnet artnet("", test_port);
+    artnet.set_discovery(false);
+    ASSERT_TRUE(artnet.add_node("127.0.0.1", { monet::sink::artnet::port_address(3), monet::sink::artnet::port_address(300) }));
+    ASSERT_TRUE(artnet.initialize(server));
+
+    auto& universe3 = server.get_universe(3);
+    auto& universe7 = server.get_universe(7);
+    auto& universe300 = server.get_universe(300);
+    universe3.set_address(1, 33);
+    universe3.set_address(3, 34);
+    universe7.set_address(1, 77);
+    universe300.set_address(512, 200);
+
+    std::array<monet::sink::frame_universe, 3> const frame{{
+        { 3, &universe3 },
+        { 7, &universe7 },
+        { 300, &universe300 }
+    }};
+
+    artnet.send_frame(frame);
+
+    std::array<uint8_t, 1024> buffer{};
+    std::vector<std::vector<uint8_t>> received;
+
+    for (int i = 0; i < 3; ++i) {
+        auto const size = recv(receiver, buffer.data(), buffer.size(), 0);
+        ASSERT_GT(size, 0);
+        received.emplace_back(buffer.begin(), buffer.begin() + size);
+    }
+
+    auto const& dmx3 = received[0];
+    ASSERT_EQ(dmx3.size(), monet::sink::artnet::dmx_header_size + 4);
+    EXPECT_EQ(std::string(reinterpret_cast<char const*>(dmx3.data())), "Art-Net");
+    EXPECT_EQ(dmx3[8], 0x00);
+    EXPECT_EQ(dmx3[9], 0x50);
+    EXPECT_EQ(dmx3[11], 14);
+    EXPECT_EQ(dmx3[12], 1);
+    // Universe 3 is port address 2; the length is rounded up to an even amount.
+    EXPECT_EQ(dmx3[14], 2);
+    EXPECT_EQ(dmx3[15], 0);
+    EXPECT_EQ(dmx3[16] << 8 | dmx3[17], 4);
+    EXPECT_EQ(dmx3[18], 33);
+    EXPECT_EQ(dmx3[20], 34);
+
+    // Universe 7 has no node, so the next packet is universe 300, on net 1.
+    auto const& dmx300 = received[1];
+    ASSERT_EQ(dmx300.size(), monet::sink::artnet::dmx_header_size + 512);
+    EXPECT_EQ(dmx300[14], 299 & 0xFF);
+    EXPECT_EQ(dmx300[15], 1);
+    EXPECT_EQ(dmx300.back(), 200);
+
+    // The frame ends with an ArtSync.
+    auto const& sync = received[2];
+    ASSERT_EQ(sync.size(), 14);
+    EXPECT_EQ(sync[8], 0x00);
+    EXPECT_EQ(sync[9], 0x52);
+
+    // Sequence numbers advance per universe.
+    artnet.send_frame(std::span(frame).first(1));
+    ASSERT_GT(recv(receiver, buffer.data(), buffer.size(), 0), 0);
+    EXPECT_EQ(buffer[14], 2);
+    EXPECT_EQ(buffer[12], 2);
+
+    artnet.deinitialize();
+    close(receiver);
+}
+
+TEST(Sinks, ArtNetMirror) {
+    constexpr uint16_t test_port = 16456;
+
+    monet::server server;
+
+    int const receiver = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    ASSERT_GE(receiver, 0);
+
+    timeval timeout{ .tv_sec = 1, .tv_usec = 0 };
+    setsockopt(receiver, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    sockaddr_in local{ .sin_family = AF_INET, .sin_port = htons(test_port) };
+    inet_pton(AF_INET, "127.0.0.1", &local.sin_addr);
+    ASSERT_EQ(bind(receiver, reinterpret_cast<sockaddr const*>(&local), sizeof(local)), 0);
+
+    monet::sink::artnet artnet("", test_port);
+    artnet.set_discovery(false);
+    artnet.set_sync(false);
+    ASSERT_TRUE(artnet.add_node("127.0.0.1", { 0, 5 }));
+    ASSERT_TRUE(artnet.initialize(server));
+
+    auto& universe = server.get_universe(1);
+    universe.set_address(1, 11);
+    universe.set_address(2, 22);
+
+    // Universe 1 mirrored to 0:0:0 and 0:0:5.
+    EXPECT_EQ(monet::sink::artnet::universe_number(0, 0, 5), 6);
+
+    std::array<monet::sink::frame_universe, 2> const frame{{
+        { 1, &universe },
+        { monet::sink::artnet::universe_number(0, 0, 5), &universe }
+    }};
+
+    artnet.send_frame(frame);
+
+    std::array<std::array<uint8_t, 1024>, 2> received{};
+
+    for (auto& packet : received) {
+        ASSERT_EQ(recv(receiver, packet.data(), packet.size(), 0), monet::sink::artnet::dmx_header_size + 2);
+    }
+
+    EXPECT_EQ(received[0][14], 0);
+    EXPECT_EQ(received[1][14], 5);
+
+    for (auto const& packet : received) {
+        EXPECT_EQ(packet[18], 11);
+        EXPECT_EQ(packet[19], 22);
+    }
+
+    artnet.deinitialize();
+    close(receiver);
+}
@@ -0,0 +1,47 @@
+//
+// Created by maxng on 10/18/2026.
+//
+
+#include <monet.hpp>
+#include <gtest/gtest.h>
+
+TEST(WorkerPool, RunsEveryTask) {
+    monet::worker_pool pool(4);
+
+    ASSERT_EQ(pool.thread_count(), 4);
+
+    std::vector<std::atomic<int>> counts(1000);
+
+    // Several runs back to back, each task exactly once.
+    for (int run = 0; run < 10; ++run) {
+        pool.run(counts.size(), [&] (size_t const a_index) {
+            counts[a_index].fetch_add(1, std::memory_order_relaxed);
+        });
+    }
+
+    for (auto const& count : counts) {
+        EXPECT_EQ(count.load(), 10);
+    }
+}
+
+TEST(WorkerPool, ThreadCount) {
+    monet::worker_pool pool;
+
+    EXPECT_EQ(pool.thread_count(), 1);
+
+    size_t sum = 0;
+
+    // A single thread runs tasks in order on the caller.
+    pool.run(100, [&] (size_t const a_index) { sum += a_index; });
+    EXPECT_EQ(sum, 4950);
+
+    pool.set_thread_count(3);
+    EXPECT_EQ(pool.thread_count(), 3);
+
+    std::atomic<size_t> parallel_sum = 0;
+    pool.run(100, [&] (size_t const a_index) { parallel_sum += a_index; });
+    EXPECT_EQ(parallel_sum.load(), 4950);
+
+    pool.set_thread_count(0);
+    EXPECT_EQ(pool.thread_count(), 1);
+}